@@ -0,0 +1,56 @@
+# pylint: disable=missing-function-docstring, invalid-name
+"""In this file we measure how the throughput of Sims1 scales with the number
+of threads, on some presentations from presentation.examples. For each number
+of threads, the number of nodes of the search tree visited per second, and
+the per-thread statistics recorded by a SimsThreadStats object, are printed.
+
+Usage: python sims_thread_scaling.py [max_threads]
+"""
+
+import os
+import sys
+import time
+
+from libsemigroups_pybind11 import Sims1, SimsThreadStats
+from libsemigroups_pybind11.presentation import examples
+
+# Each entry is (name, presentation, maximum number of classes)
+BENCHMARKS = [
+    ("full_transformation_monoid(3)", examples.full_transformation_monoid(3), 27),
+    ("symmetric_inverse_monoid(3)", examples.symmetric_inverse_monoid(3), 34),
+    ("temperley_lieb_monoid(5)", examples.temperley_lieb_monoid(5), 42),
+]
+
+
+def run(p, n: int, threads: int) -> None:
+    stats = SimsThreadStats()
+    s = Sims1(p).number_of_threads(threads).add_pruner(stats.pruner())
+    start = time.perf_counter()
+    count = s.number_of_congruences(n)
+    elapsed = time.perf_counter() - start
+    nodes = stats.nodes()
+    idle = [t.total_seconds() for t in stats.idle_time()]
+    print(
+        f"  {threads:>3} threads: {count} congruences in {elapsed:.3f}s, "
+        f"{sum(nodes) / elapsed:,.0f} nodes/s, "
+        f"nodes per thread {min(nodes)}-{max(nodes)}, "
+        f"max idle {max(idle):.3f}s, "
+        f"idle periods {sum(stats.idle_periods())}"
+    )
+
+
+def main() -> None:
+    max_threads = int(sys.argv[1]) if len(sys.argv) > 1 else os.cpu_count()
+    threads = [1]
+    while threads[-1] * 2 <= max_threads:
+        threads.append(threads[-1] * 2)
+    if threads[-1] != max_threads:
+        threads.append(max_threads)
+    for name, p, n in BENCHMARKS:
+        print(f"{name}, at most {n} classes:")
+        for t in threads:
+            run(p, n, t)
+
+
+if __name__ == "__main__":
+    main()
@@ -38,7 +38,9 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_action
+#include "main.hpp"    // for init_action
+#include "memory.hpp"  // for def_memory_usage, element_memory_usage
+#include "runner.hpp"  // for run_releasing_gil
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -271,9 +273,13 @@ Checks if the :py:class:`Action` contains any points.
    Constant.
 )pbdoc");
 
-      thing.def("size",
-                &Action_::size,
-                R"pbdoc(
+      thing.def(
+          "size",
+          [](Action_& self) {
+            return run_releasing_gil(
+                self, "Action.size", [&self]() { return self.size(); });
+          },
+          R"pbdoc(
 :sig=(self: Action) -> int:
 
 Returns the size of the fully enumerated action.
@@ -304,6 +310,19 @@ Returns the number of points found so far.
 :complexity:
    Constant.
 )pbdoc");
+      // Every point is stored once, with one entry in a hash map, and the
+      // orbit graph has one row per point. All points are assumed to use the
+      // same amount of memory as the first one.
+      def_memory_usage(thing, "Action", [](Action_& a) {
+        size_t const n = a.current_size();
+        if (n == 0) {
+          return size_t(0);
+        }
+        return n
+               * (element_memory_usage(a.at(0)) + 3 * sizeof(void*)
+                  + a.number_of_generators() * sizeof(uint32_t));
+      });
+
       thing.def(
           "cache_scc_multipliers",
           [](Action_ const& self) { return self.cache_scc_multipliers(); },
@@ -0,0 +1,125 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_BOUNDED_QUEUE_HPP_
+#define SRC_BOUNDED_QUEUE_HPP_
+
+// C++ stl headers....
+#include <atomic>   // for atomic, memory_order
+#include <cstddef>  // for size_t, ptrdiff_t
+#include <memory>   // for unique_ptr, make_unique
+#include <utility>  // for move
+
+// libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+
+namespace libsemigroups {
+
+  // A bounded multi-producer multi-consumer queue (D. Vyukov's algorithm).
+  // Pushing and popping never lock or allocate, and fail if the queue is
+  // full or empty, respectively. The capacity is rounded up to a power of 2.
+  template <typename T>
+  class BoundedQueue {
+   public:
+    explicit BoundedQueue(size_t capacity)
+        : _cells(), _mask(), _head(0), _tail(0) {
+      if (capacity == 0) {
+        LIBSEMIGROUPS_EXCEPTION("the capacity must be positive, found 0");
+      }
+      size_t n = 1;
+      while (n < capacity) {
+        n <<= 1;
+      }
+      _cells = std::make_unique<Cell[]>(n);
+      for (size_t i = 0; i < n; ++i) {
+        _cells[i].seq.store(i, std::memory_order_relaxed);
+      }
+      _mask = n - 1;
+    }
+
+    BoundedQueue(BoundedQueue const&)            = delete;
+    BoundedQueue& operator=(BoundedQueue const&) = delete;
+
+    [[nodiscard]] size_t capacity() const noexcept {
+      return _mask + 1;
+    }
+
+    // Moves x into the queue and returns true, or returns false and leaves x
+    // unchanged if the queue is full.
+    bool try_push(T& x) {
+      size_t pos = _tail.load(std::memory_order_relaxed);
+      for (;;) {
+        Cell&  cell = _cells[pos & _mask];
+        size_t seq  = cell.seq.load(std::memory_order_acquire);
+        auto   diff = static_cast<std::ptrdiff_t>(seq)
+                    - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+          if (_tail.compare_exchange_weak(
+                  pos, pos + 1, std::memory_order_relaxed)) {
+            cell.value = std::move(x);
+            cell.seq.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = _tail.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    // Moves the front of the queue into x and returns true, or returns false
+    // if the queue is empty.
+    bool try_pop(T& x) {
+      size_t pos = _head.load(std::memory_order_relaxed);
+      for (;;) {
+        Cell&  cell = _cells[pos & _mask];
+        size_t seq  = cell.seq.load(std::memory_order_acquire);
+        auto   diff = static_cast<std::ptrdiff_t>(seq)
+                    - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+          if (_head.compare_exchange_weak(
+                  pos, pos + 1, std::memory_order_relaxed)) {
+            x = std::move(cell.value);
+            cell.seq.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          return false;
+        } else {
+          pos = _head.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+   private:
+    struct Cell {
+      std::atomic<size_t> seq;
+      T                   value;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    size_t                  _mask;
+    // head and tail are on separate cache lines so that producers and
+    // consumers do not contend.
+    alignas(64) std::atomic<size_t> _head;
+    alignas(64) std::atomic<size_t> _tail;
+  };
+}  // namespace libsemigroups
+
+#endif  // SRC_BOUNDED_QUEUE_HPP_
@@ -18,9 +18,18 @@
 
 #include "cong-common.hpp"  // for doc
 
-#include <string_view>
+#include <algorithm>      // for max, min
+#include <atomic>         // for atomic_bool
+#include <exception>      // for exception_ptr, current_exception
+#include <functional>     // for ref
+#include <string_view>    // for string_view
+#include <thread>         // for thread
+#include <unordered_set>  // for unordered_set
+#include <utility>        // for pair
+#include <vector>         // for vector
 
 // libsemigroups headers
+#include <libsemigroups/adapters.hpp>  // for Hash
 #include <libsemigroups/cong.hpp>
 #include <libsemigroups/kambites.hpp>
 #include <libsemigroups/knuth-bendix.hpp>
@@ -30,12 +39,15 @@
 #include <libsemigroups/detail/cong-common-class.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
 #include "constants.hpp"
-#include "main.hpp"  // for init_detail_cong_common
+#include "main.hpp"          // for init_detail_cong_common
+#include "packed-words.hpp"  // for pack_words, unpack_words
+#include "runner.hpp"        // for call_releasing_gil, for_each_thread
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -90,6 +102,147 @@ namespace libsemigroups {
                      "var"_a    = extra_doc.var);
       return result.c_str();
     }
+
+    // Calls func(thing, i) for every i in [0, n), in the given number of
+    // threads, the first of which uses self, and every other thread uses its
+    // own copy of self, so that func does not have to be thread safe. The
+    // copies are made after self is run, so that they are not run again. If
+    // this is interrupted, then self is killed if it has not finished running,
+    // and every thread stops before its next index.
+    template <typename Thing, typename Func>
+    void run_for_each_index(Thing&      self,
+                            char const* name,
+                            size_t      n,
+                            size_t      threads,
+                            Func&&      func) {
+      std::atomic_bool stop(false);
+      auto             kill = [&self, &stop]() {
+        stop = true;
+        if (!self.finished()) {
+          self.kill();
+        }
+      };
+      call_releasing_gil(
+          name,
+          [&]() {
+            self.run();
+            if (stop) {
+              return;
+            }
+            threads = std::max(size_t(1), std::min(threads, n));
+            size_t const                    chunk = (n + threads - 1) / threads;
+            std::vector<std::exception_ptr> errors(threads);
+            auto work = [&](Thing& thing, size_t t) {
+              try {
+                size_t const last = std::min(n, (t + 1) * chunk);
+                for (size_t i = t * chunk; i < last && !stop; ++i) {
+                  func(thing, i);
+                }
+              } catch (...) {
+                errors[t] = std::current_exception();
+              }
+            };
+            std::vector<Thing>       copies(threads - 1, self);
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < threads; ++t) {
+              workers.emplace_back(work, std::ref(copies[t - 1]), t);
+            }
+            work(self, 0);
+            for (auto& w : workers) {
+              w.join();
+            }
+            for (auto const& e : errors) {
+              if (e) {
+                std::rethrow_exception(e);
+              }
+            }
+          },
+          kill);
+    }
+
+    template <typename Thing, typename Word>
+    py::array_t<bool> contains_many(Thing&                   self,
+                                    char const*              name,
+                                    std::vector<Word> const& words,
+                                    size_t                   threads) {
+      py::array_t<bool> result(words.size() / 2);
+      bool*             out = result.mutable_data();
+      run_for_each_index(
+          self,
+          name,
+          words.size() / 2,
+          threads,
+          [&words, out](Thing& thing, size_t i) {
+            out[i] = congruence_common::contains(
+                thing, words[2 * i], words[2 * i + 1]);
+          });
+      return result;
+    }
+
+    template <typename Thing, typename Word>
+    std::vector<Word> reduce_many(Thing&                   self,
+                                  char const*              name,
+                                  std::vector<Word> const& words,
+                                  size_t                   threads) {
+      std::vector<Word> result(words.size());
+      run_for_each_index(self,
+                         name,
+                         words.size(),
+                         threads,
+                         [&words, &result](Thing& thing, size_t i) {
+                           result[i]
+                               = congruence_common::reduce(thing, words[i]);
+                         });
+      return result;
+    }
+
+    // Returns an array ids such that ids[i] == ids[j] if and only if words[i]
+    // and words[j] belong to the same class, where the classes are numbered
+    // in order of their first appearance in words. The words are reduced using
+    // reduce_many, and the normal forms are then bucketed by their hash
+    // values, each thread handling a disjoint set of buckets.
+    template <typename Thing, typename Word>
+    py::array_t<uint64_t> partition_ids(Thing&                   self,
+                                        char const*              name,
+                                        std::vector<Word> const& words,
+                                        size_t                   threads) {
+      auto const            nf = reduce_many(self, name, words, threads);
+      size_t const          n  = nf.size();
+      py::array_t<uint64_t> result(n);
+      uint64_t*             out = result.mutable_data();
+      {
+        py::gil_scoped_release release;
+        threads = std::max(size_t(1), std::min(threads, n));
+        size_t const        chunk = (n + threads - 1) / threads;
+        std::vector<size_t> hashes(n), first(n);
+
+        for_each_thread(threads, [&](size_t t) {
+          Hash<Word> hash;
+          for (size_t i = t * chunk; i < std::min(n, (t + 1) * chunk); ++i) {
+            hashes[i] = hash(nf[i]);
+          }
+        });
+
+        // first[i] is the least index j such that nf[i] == nf[j]
+        for_each_thread(threads, [&](size_t t) {
+          auto hash  = [&hashes](size_t i) { return hashes[i]; };
+          auto equal = [&nf](size_t i, size_t j) { return nf[i] == nf[j]; };
+          std::unordered_set<size_t, decltype(hash), decltype(equal)> seen(
+              0, hash, equal);
+          for (size_t i = 0; i < n; ++i) {
+            if (hashes[i] % threads == t) {
+              first[i] = *seen.insert(i).first;
+            }
+          }
+        });
+
+        uint64_t next = 0;
+        for (size_t i = 0; i < n; ++i) {
+          out[i] = (first[i] == i ? next++ : out[first[i]]);
+        }
+      }
+      return result;
+    }
   }  // namespace
 
   ////////////////////////////////////////////////////////////////////////
@@ -483,9 +636,15 @@ Copy a :any:`{name}` object.
   void def_number_of_classes(py::class_<Thing, ThingBase>& thing,
                              std::string_view              name,
                              doc                           extra_doc) {
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.number_of_classes", name));
     thing.def(
         "number_of_classes",
-        [](Thing& self) { return from_int(self.number_of_classes()); },
+        [trace_name](Thing& self) {
+          return from_int(run_releasing_gil(self, trace_name, [&self]() {
+            return self.number_of_classes();
+          }));
+        },
         make_doc(R"pbdoc(
 :sig=(self: {name}) -> int | PositiveInfinity:
 {only_document_once}
@@ -739,11 +898,15 @@ contained in the congruence, but that this is not currently known.
                     std::string_view              name,
                     doc                           extra_doc) {
     using Word = typename Thing::native_word_type;
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.contains", name));
 
     thing.def(
         "contains",
-        [](Thing& self, Word const& u, Word const& v) {
-          return congruence_common::contains(self, u, v);
+        [trace_name](Thing& self, Word const& u, Word const& v) {
+          return run_releasing_gil(self, trace_name, [&self, &u, &v]() {
+            return congruence_common::contains(self, u, v);
+          });
         },
         py::arg("u"),
         py::arg("v"),
@@ -906,10 +1069,14 @@ normal form for the input word *w*.
                   std::string_view              name,
                   doc                           extra_doc) {
     using Word = typename Thing::native_word_type;
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.reduce", name));
     thing.def(
         "reduce",
-        [](Thing& self, Word const& w) {
-          return congruence_common::reduce(self, w);
+        [trace_name](Thing& self, Word const& w) {
+          return run_releasing_gil(self, trace_name, [&self, &w]() {
+            return congruence_common::reduce(self, w);
+          });
         },
         py::arg("w"),
         make_doc(R"pbdoc(
@@ -977,6 +1144,337 @@ input word.
   ////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////
 
+  template <typename Thing, typename ThingBase>
+  void def_contains_many(py::class_<Thing, ThingBase>& thing,
+                         std::string_view              name,
+                         doc                           extra_doc) {
+    using Word = typename Thing::native_word_type;
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.contains_many", name));
+
+    thing.def(
+        "contains_many",
+        [trace_name](Thing&                                    self,
+                     std::vector<std::pair<Word, Word>> const& pairs,
+                     size_t                                    threads) {
+          std::vector<Word> words;
+          words.reserve(2 * pairs.size());
+          for (auto const& [u, v] : pairs) {
+            words.push_back(u);
+            words.push_back(v);
+          }
+          return contains_many(self, trace_name, words, threads);
+        },
+        py::arg("pairs"),
+        py::arg("threads") = 1,
+        make_doc(R"pbdoc(
+:sig=(self: {name}, pairs: list[tuple[list[int], list[int]] | tuple[str, str]], threads: int = 1) -> numpy.ndarray:
+{only_document_once}
+
+Check containment of many pairs of words.
+
+This function triggers a full enumeration of a :py:class:`{name}` instance,
+and then checks whether or not each pair of words in *pairs* is contained in
+the congruence it represents. This is equivalent to, but much faster than,
+calling :any:`{name}.contains` for every pair in *pairs*, since all of the
+pairs are checked in C++, with the GIL released.
+
+:param pairs: the pairs of words.
+:type pairs: list[tuple[list[int], list[int]]] | list[tuple[str, str]]
+
+:param threads:
+  the number of threads to use (default: ``1``). If this is greater than
+  ``1``, then every thread except one uses its own copy of *self*, made after
+  *self* is run, and so each thread can proceed independently of the others.
+:type threads: int
+
+:returns:
+  A boolean array whose ``i``-th entry is ``True`` if and only if
+  ``pairs[i]`` belongs to the congruence.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if any of the values in any word in *pairs* is out of range, i.e. they do
+  not belong to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 name,
+                 extra_doc));
+
+    thing.def(
+        "contains_many",
+        [trace_name](Thing&                     self,
+                     letters_array<Word> const& letters,
+                     offsets_array const&       offsets,
+                     size_t                     threads) {
+          auto words = unpack_words<Word>(letters, offsets);
+          if (words.size() % 2 != 0) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected an even number of words, found {}", words.size());
+          }
+          return contains_many(self, trace_name, words, threads);
+        },
+        py::arg("letters"),
+        py::arg("offsets"),
+        py::arg("threads") = 1,
+        make_doc(R"pbdoc(
+:sig=(self: {name}, letters: numpy.ndarray, offsets: numpy.ndarray, threads: int = 1) -> numpy.ndarray:
+{only_document_once}
+
+Check containment of many pairs of words packed into arrays.
+
+This function is the same as the other overload of this function, except that
+the words are packed into two arrays, and so the pairs of words can be passed
+without creating a Python object for every word. The ``i``-th word is
+``letters[offsets[i]:offsets[i + 1]]``, and the ``i``-th pair of words consists
+of the words with indices ``2 * i`` and ``2 * i + 1``. If the words of *self*
+are strings, then *letters* should be an array of ``uint8``, such as
+``numpy.frombuffer(b, dtype=numpy.uint8)`` for a ``bytes`` object ``b``, and
+otherwise it can be an array of any integer type.
+
+:param letters: the letters of all of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:param threads:
+  the number of threads to use (default: ``1``). If this is greater than
+  ``1``, then every thread except one uses its own copy of *self*, made after
+  *self* is run, and so each thread can proceed independently of the others.
+:type threads: int
+
+:returns:
+  A boolean array whose ``i``-th entry is ``True`` if and only if the ``i``-th
+  pair of words belongs to the congruence.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *offsets* is empty, not non-decreasing, or its last entry is greater
+  than the length of *letters*.
+
+:raises LibsemigroupsError: if the number of words is odd.
+
+:raises LibsemigroupsError:
+  if any of the values in *letters* is out of range, i.e. they do not belong
+  to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_CONTAINS_MANY(A, B)          \
+  template void def_contains_many<A, B>( \
+      py::class_<A, B>&, std::string_view, doc)
+
+  DEF_CONTAINS_MANY(detail::ToddCoxeterImpl, detail::CongruenceCommon);
+
+  DEF_CONTAINS_MANY(ToddCoxeter<word_type>, detail::ToddCoxeterImpl);
+  DEF_CONTAINS_MANY(ToddCoxeter<std::string>, detail::ToddCoxeterImpl);
+
+  DEF_CONTAINS_MANY(Kambites<word_type>, detail::CongruenceCommon);
+  DEF_CONTAINS_MANY(Kambites<MultiView<std::string>>, detail::CongruenceCommon);
+  DEF_CONTAINS_MANY(Kambites<std::string>, detail::CongruenceCommon);
+
+  DEF_CONTAINS_MANY(detail::KnuthBendixImpl<LenLexTrie>,
+                    detail::CongruenceCommon);
+  DEF_CONTAINS_MANY(detail::KnuthBendixImpl<LenLexSet>,
+                    detail::CongruenceCommon);
+
+  DEF_CONTAINS_MANY(KnuthBendixStringLenLexTrie,
+                    detail::KnuthBendixImpl<LenLexTrie>);
+  DEF_CONTAINS_MANY(KnuthBendixStringLenLexSet,
+                    detail::KnuthBendixImpl<LenLexSet>);
+  DEF_CONTAINS_MANY(KnuthBendixWordLenLexTrie,
+                    detail::KnuthBendixImpl<LenLexTrie>);
+  DEF_CONTAINS_MANY(KnuthBendixWordLenLexSet,
+                    detail::KnuthBendixImpl<LenLexSet>);
+
+  DEF_CONTAINS_MANY(detail::KnuthBendixImpl<RevRPOTrie>,
+                    detail::CongruenceCommon);
+  DEF_CONTAINS_MANY(detail::KnuthBendixImpl<RevRPOSet>,
+                    detail::CongruenceCommon);
+
+  DEF_CONTAINS_MANY(KnuthBendixStringRevRPOTrie,
+                    detail::KnuthBendixImpl<RevRPOTrie>);
+  DEF_CONTAINS_MANY(KnuthBendixStringRevRPOSet,
+                    detail::KnuthBendixImpl<RevRPOSet>);
+  DEF_CONTAINS_MANY(KnuthBendixWordRevRPOTrie,
+                    detail::KnuthBendixImpl<RevRPOTrie>);
+  DEF_CONTAINS_MANY(KnuthBendixWordRevRPOSet,
+                    detail::KnuthBendixImpl<RevRPOSet>);
+
+  DEF_CONTAINS_MANY(Congruence<word_type>, detail::CongruenceCommon);
+  DEF_CONTAINS_MANY(Congruence<std::string>, detail::CongruenceCommon);
+
+  ////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////
+
+  template <typename Thing, typename ThingBase>
+  void def_reduce_many(py::class_<Thing, ThingBase>& thing,
+                       std::string_view              name,
+                       doc                           extra_doc) {
+    using Word = typename Thing::native_word_type;
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.reduce_many", name));
+
+    thing.def(
+        "reduce_many",
+        [trace_name](
+            Thing& self, std::vector<Word> const& words, size_t threads) {
+          return reduce_many(self, trace_name, words, threads);
+        },
+        py::arg("words"),
+        py::arg("threads") = 1,
+        make_doc(R"pbdoc(
+:sig=(self: {name}, words: list[list[int]] | list[str], threads: int = 1) -> list[list[int]] | list[str]:
+{only_document_once}
+
+Reduce many words.
+
+This function triggers a full enumeration of a :py:class:`{name}` instance,
+and then reduces every word in *words*. This is equivalent to, but much faster
+than, calling :any:`{name}.reduce` for every word in *words*, since all of the
+words are reduced in C++, with the GIL released.
+
+{detail}
+
+:param words: the input words.
+:type words: list[list[int]] | list[str]
+
+:param threads:
+  the number of threads to use (default: ``1``). If this is greater than
+  ``1``, then every thread except one uses its own copy of *self*, made after
+  *self* is run, and so each thread can proceed independently of the others.
+:type threads: int
+
+:returns: The list of normal forms of the words in *words*.
+:rtype: list[list[int]] | list[str]
+
+:raises LibsemigroupsError:
+  if any of the values in any word in *words* is out of range, i.e. they do
+  not belong to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 name,
+                 extra_doc));
+
+    thing.def(
+        "reduce_many",
+        [trace_name](Thing&                     self,
+                     letters_array<Word> const& letters,
+                     offsets_array const&       offsets,
+                     size_t                     threads) {
+          return pack_words(reduce_many(self,
+                                        trace_name,
+                                        unpack_words<Word>(letters, offsets),
+                                        threads));
+        },
+        py::arg("letters"),
+        py::arg("offsets"),
+        py::arg("threads") = 1,
+        make_doc(R"pbdoc(
+:sig=(self: {name}, letters: numpy.ndarray, offsets: numpy.ndarray, threads: int = 1) -> tuple[numpy.ndarray, numpy.ndarray]:
+{only_document_once}
+
+Reduce many words packed into arrays.
+
+This function is the same as the other overload of this function, except that
+the input and output words are packed into two arrays, and so no Python object
+is created for any word. The ``i``-th word is
+``letters[offsets[i]:offsets[i + 1]]``. If the words of *self* are strings,
+then *letters* should be an array of ``uint8``, such as
+``numpy.frombuffer(b, dtype=numpy.uint8)`` for a ``bytes`` object ``b``, and
+otherwise it can be an array of any integer type.
+
+{detail}
+
+:param letters: the letters of all of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:param threads:
+  the number of threads to use (default: ``1``). If this is greater than
+  ``1``, then every thread except one uses its own copy of *self*, made after
+  *self* is run, and so each thread can proceed independently of the others.
+:type threads: int
+
+:returns:
+  The pair of arrays ``(letters, offsets)`` packing the normal forms of the
+  input words in the same way.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError:
+  if *offsets* is empty, not non-decreasing, or its last entry is greater
+  than the length of *letters*.
+
+:raises LibsemigroupsError:
+  if any of the values in *letters* is out of range, i.e. they do not belong
+  to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_REDUCE_MANY(A, B)          \
+  template void def_reduce_many<A, B>( \
+      py::class_<A, B>&, std::string_view, doc)
+
+  DEF_REDUCE_MANY(detail::ToddCoxeterImpl, detail::CongruenceCommon);
+
+  DEF_REDUCE_MANY(ToddCoxeter<word_type>, detail::ToddCoxeterImpl);
+  DEF_REDUCE_MANY(ToddCoxeter<std::string>, detail::ToddCoxeterImpl);
+
+  DEF_REDUCE_MANY(Kambites<word_type>, detail::CongruenceCommon);
+  DEF_REDUCE_MANY(Kambites<MultiView<std::string>>, detail::CongruenceCommon);
+  DEF_REDUCE_MANY(Kambites<std::string>, detail::CongruenceCommon);
+
+  DEF_REDUCE_MANY(detail::KnuthBendixImpl<LenLexTrie>,
+                  detail::CongruenceCommon);
+  DEF_REDUCE_MANY(detail::KnuthBendixImpl<LenLexSet>, detail::CongruenceCommon);
+
+  DEF_REDUCE_MANY(KnuthBendixStringLenLexTrie,
+                  detail::KnuthBendixImpl<LenLexTrie>);
+  DEF_REDUCE_MANY(KnuthBendixStringLenLexSet,
+                  detail::KnuthBendixImpl<LenLexSet>);
+  DEF_REDUCE_MANY(KnuthBendixWordLenLexTrie,
+                  detail::KnuthBendixImpl<LenLexTrie>);
+  DEF_REDUCE_MANY(KnuthBendixWordLenLexSet, detail::KnuthBendixImpl<LenLexSet>);
+
+  DEF_REDUCE_MANY(detail::KnuthBendixImpl<RevRPOTrie>,
+                  detail::CongruenceCommon);
+  DEF_REDUCE_MANY(detail::KnuthBendixImpl<RevRPOSet>, detail::CongruenceCommon);
+
+  DEF_REDUCE_MANY(KnuthBendixStringRevRPOTrie,
+                  detail::KnuthBendixImpl<RevRPOTrie>);
+  DEF_REDUCE_MANY(KnuthBendixStringRevRPOSet,
+                  detail::KnuthBendixImpl<RevRPOSet>);
+  DEF_REDUCE_MANY(KnuthBendixWordRevRPOTrie,
+                  detail::KnuthBendixImpl<RevRPOTrie>);
+  DEF_REDUCE_MANY(KnuthBendixWordRevRPOSet, detail::KnuthBendixImpl<RevRPOSet>);
+
+  DEF_REDUCE_MANY(Congruence<word_type>, detail::CongruenceCommon);
+  DEF_REDUCE_MANY(Congruence<std::string>, detail::CongruenceCommon);
+
+  ////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////
+
   template <typename Thing, typename ThingBase>
   void def_generating_pairs(py::class_<Thing, ThingBase>& thing,
                             std::string_view              name,
@@ -1257,6 +1755,158 @@ instance *{var}*.
   ////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////
 
+  template <typename Thing>
+  void def_partition_ids(py::module&      m,
+                         std::string_view class_name,
+                         std::string_view func_prefix,
+                         doc              extra_doc) {
+    using Word = typename Thing::native_word_type;
+
+    std::string func_name = fmt::format("{}_partition_ids", func_prefix);
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.partition_ids", func_prefix));
+    m.def(
+        func_name.c_str(),
+        [trace_name](
+            Thing& ci, std::vector<Word> const& words, size_t threads) {
+          return partition_ids(ci, trace_name, words, threads);
+        },
+        py::arg(extra_doc.var.data()),
+        py::arg("words"),
+        py::arg("threads") = 1,
+        make_doc(R"pbdoc(
+:sig=({var}: {name}, words: list[list[int]] | list[str], threads: int = 1) -> numpy.ndarray:
+{only_document_once}
+
+Find the classes of a list of words as an array of integers.
+
+This function returns a NumPy array ``ids`` of ``uint64`` with the same length
+as *words*, such that ``ids[i] == ids[j]`` if and only if ``words[i]`` and
+``words[j]`` belong to the same class of the congruence represented by the
+:any:`{name}` instance *{var}*. The classes are numbered :math:`0, 1, \ldots`
+in the order that they first appear in *words*. This function triggers a full
+enumeration of *{var}*.
+
+This function contains the same information as ``partition`` and
+``non_trivial_classes`` in the same module, but is much faster when *words* is
+large. The words are reduced in C++ with the GIL released, using
+:any:`{name}.reduce_many`, and the normal forms are then bucketed by their hash
+values, in parallel if *threads* is greater than ``1``.
+
+{detail}
+
+:param {var}: the :any:`{name}` instance.
+:type {var}: {name}
+
+:param words: the input list of words.
+:type words: list[list[int]] | list[str]
+
+:param threads:
+  the number of threads to use (default: ``1``), see
+  :any:`{name}.reduce_many`.
+:type threads: int
+
+:returns: The class of every word in *words*.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if any of the values in any word in *words* is out of range, i.e. they do
+  not belong to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 class_name,
+                 extra_doc));
+
+    m.def(
+        func_name.c_str(),
+        [trace_name](Thing&                     ci,
+                     letters_array<Word> const& letters,
+                     offsets_array const&       offsets,
+                     size_t                     threads) {
+          return partition_ids(ci,
+                               trace_name,
+                               unpack_words<Word>(letters, offsets),
+                               threads);
+        },
+        py::arg(extra_doc.var.data()),
+        py::arg("letters"),
+        py::arg("offsets"),
+        py::arg("threads") = 1,
+        make_doc(R"pbdoc(
+:sig=({var}: {name}, letters: numpy.ndarray, offsets: numpy.ndarray, threads: int = 1) -> numpy.ndarray:
+{only_document_once}
+
+Find the classes of words packed into arrays as an array of integers.
+
+This function is the same as the other overload of this function, except that
+the input words are packed into two arrays, in the same way as for
+:any:`{name}.reduce_many`, and so no Python object is created for any word.
+
+{detail}
+
+:param {var}: the :any:`{name}` instance.
+:type {var}: {name}
+
+:param letters: the letters of all of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:param threads:
+  the number of threads to use (default: ``1``), see
+  :any:`{name}.reduce_many`.
+:type threads: int
+
+:returns: The class of every input word.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *offsets* is empty, not non-decreasing, or its last entry is greater
+  than the length of *letters*.
+
+:raises LibsemigroupsError:
+  if any of the values in *letters* is out of range, i.e. they do not belong
+  to ``presentation().alphabet()`` and
+  :any:`Presentation.throw_if_letter_not_in_alphabet` raises.
+
+{raises}
+)pbdoc",
+                 class_name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_PARTITION_IDS(Thing)          \
+  template void def_partition_ids<Thing>( \
+      py::module&, std::string_view, std::string_view, doc)
+
+  DEF_PARTITION_IDS(ToddCoxeter<word_type>);
+  DEF_PARTITION_IDS(ToddCoxeter<std::string>);
+
+  DEF_PARTITION_IDS(Kambites<word_type>);
+  DEF_PARTITION_IDS(Kambites<MultiView<std::string>>);
+  DEF_PARTITION_IDS(Kambites<std::string>);
+
+  DEF_PARTITION_IDS(KnuthBendixStringLenLexTrie);
+  DEF_PARTITION_IDS(KnuthBendixStringLenLexSet);
+  DEF_PARTITION_IDS(KnuthBendixWordLenLexTrie);
+  DEF_PARTITION_IDS(KnuthBendixWordLenLexSet);
+
+  DEF_PARTITION_IDS(KnuthBendixStringRevRPOTrie);
+  DEF_PARTITION_IDS(KnuthBendixStringRevRPOSet);
+  DEF_PARTITION_IDS(KnuthBendixWordRevRPOTrie);
+  DEF_PARTITION_IDS(KnuthBendixWordRevRPOSet);
+
+  DEF_PARTITION_IDS(Congruence<word_type>);
+  DEF_PARTITION_IDS(Congruence<std::string>);
+
+  ////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////
+
   template <typename Thing>
   void def_normal_forms(py::module&      m,
                         std::string_view class_name,
@@ -1323,6 +1973,104 @@ the congruence represented by an instance of :any:`{name}`.
   // DEF_NORMAL_FORMS(Congruence<word_type>);
   // DEF_NORMAL_FORMS(Congruence<std::string>);
 
+  template <typename Thing>
+  void def_normal_forms_chunks(py::module&      m,
+                               std::string_view class_name,
+                               std::string_view func_prefix,
+                               doc              extra_doc) {
+    using Letter = packed_letter_type<typename Thing::native_word_type>;
+    std::string func_name(func_prefix);
+    func_name += "_normal_forms_chunks";
+    char const* trace_name = intern_trace_name(
+        fmt::format("{}.normal_forms_chunks", func_prefix));
+    m.def(
+        func_name.c_str(),
+        [trace_name](Thing& ci, size_t batch_size) {
+          // Run with the GIL released before any normal forms are requested,
+          // since normal_forms triggers a full enumeration.
+          run_releasing_gil(ci, trace_name, [&ci]() { ci.run(); });
+          auto nf = congruence_common::normal_forms(ci);
+          return make_packed_words_iterator<Letter>(
+              batch_size,
+              [nf](std::vector<Letter>& letters,
+                   std::vector<uint64_t>& offsets) mutable {
+                if (nf.at_end()) {
+                  return false;
+                }
+                append_packed_word(nf.get(), letters, offsets);
+                nf.next();
+                return true;
+              });
+        },
+        py::arg(extra_doc.var.data()),
+        py::arg("batch_size") = 65'536,
+        py::keep_alive<0, 1>(),
+        make_doc(R"pbdoc(
+:sig=({var}: {name}, batch_size: int = 65536) -> collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]:
+{only_document_once}
+
+Returns an iterator yielding chunks of normal forms as NumPy arrays.
+
+This function returns an iterator yielding the same normal forms, in the same
+order, as the function ``normal_forms`` in the same module, but in chunks of at
+most *batch_size* normal forms. Each chunk is a tuple ``(letters, offsets)`` of
+1-dimensional NumPy arrays, where ``offsets`` has length one more than the
+number of normal forms in the chunk, and the *i*-th normal form in the chunk is
+``letters[offsets[i]:offsets[i + 1]]``. The ``offsets`` always start at ``0``
+in every chunk. If *{var}* was constructed from a :any:`Presentation` over
+strings, then ``letters`` contains the code points of the characters, and
+otherwise ``letters`` contains the letters. The code points are
+``numpy.uint8`` values for :any:`ToddCoxeter` and :any:`KnuthBendix`, but
+:any:`Kambites` stores the words over strings differently, and so its code
+points have the same type as letters, ``numpy.uint64``.
+
+Any enumeration triggered by this function, and every chunk, is computed in
+C++ with the GIL released, and so this function is much faster than
+``normal_forms`` when the number of normal forms is large. If there are
+infinitely many normal forms, then the iterator yields chunks forever.
+
+{detail}
+
+:param {var}: the :any:`{name}` instance.
+:type {var}: {name}
+
+:param batch_size: the maximum number of normal forms per chunk.
+:type batch_size: int
+
+:returns: An iterator yielding pairs of arrays.
+:rtype: collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]
+
+:raises LibsemigroupsError: if *batch_size* is ``0``.
+
+{raises}
+)pbdoc",
+                 class_name,
+                 extra_doc));
+  }
+
+  ////////////////////////////////////////////////////////////////////////
+
+#define DEF_NORMAL_FORMS_CHUNKS(Thing)          \
+  template void def_normal_forms_chunks<Thing>( \
+      py::module&, std::string_view, std::string_view, doc)
+
+  DEF_NORMAL_FORMS_CHUNKS(ToddCoxeter<word_type>);
+  DEF_NORMAL_FORMS_CHUNKS(ToddCoxeter<std::string>);
+
+  DEF_NORMAL_FORMS_CHUNKS(Kambites<word_type>);
+  DEF_NORMAL_FORMS_CHUNKS(Kambites<MultiView<std::string>>);
+  DEF_NORMAL_FORMS_CHUNKS(Kambites<std::string>);
+
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixStringLenLexTrie);
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixStringLenLexSet);
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixWordLenLexTrie);
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixWordLenLexSet);
+
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixStringRevRPOTrie);
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixStringRevRPOSet);
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixWordRevRPOTrie);
+  DEF_NORMAL_FORMS_CHUNKS(KnuthBendixWordRevRPOSet);
+
   ////////////////////////////////////////////////////////////////////////
   // The init function for detail::CongruenceCommon
   ////////////////////////////////////////////////////////////////////////
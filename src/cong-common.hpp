@@ -103,6 +103,16 @@ namespace libsemigroups {
                   std::string_view              name,
                   doc                           extra_doc = {});
 
+  template <typename Thing, typename ThingBase>
+  void def_contains_many(py::class_<Thing, ThingBase>& thing,
+                         std::string_view              name,
+                         doc                           extra_doc = {});
+
+  template <typename Thing, typename ThingBase>
+  void def_reduce_many(py::class_<Thing, ThingBase>& thing,
+                       std::string_view              name,
+                       doc                           extra_doc = {});
+
   template <typename Thing, typename ThingBase>
   void def_generating_pairs(py::class_<Thing, ThingBase>& thing,
                             std::string_view              name,
@@ -129,11 +139,23 @@ namespace libsemigroups {
                      std::string_view func_prefix,
                      doc              extra_doc = {});
 
+  template <typename Thing>
+  void def_partition_ids(py::module&      m,
+                         std::string_view class_name,
+                         std::string_view func_prefix,
+                         doc              extra_doc = {});
+
   template <typename Thing>
   void def_normal_forms(py::module&      m,
                         std::string_view class_name,
                         std::string_view func_prefix,
                         doc              extra_doc = {});
 
+  template <typename Thing>
+  void def_normal_forms_chunks(py::module&      m,
+                               std::string_view class_name,
+                               std::string_view func_prefix,
+                               doc              extra_doc = {});
+
 }  // namespace libsemigroups
 #endif  // SRC_CONG_COMMON_HPP_
@@ -94,9 +94,11 @@ individual algorithms, such as :any:`Kambites`,
 
       def_currently_contains(thing, "Congruence");
       def_contains(thing, "Congruence");
+      def_contains_many(thing, "Congruence");
 
       def_reduce_no_run(thing, "Congruence");
       def_reduce(thing, "Congruence");
+      def_reduce_many(thing, "Congruence");
 
       ////////////////////////////////////////////////////////////////////////
       // Congruence specific stuff
@@ -211,6 +213,12 @@ contained in a :any:`Congruence` object.
           "congruence",
           doc{.only_document_once = true, .var = "c"});
 
+      def_partition_ids<Congruence<Word>>(
+          m,
+          "Congruence",
+          "congruence",
+          doc{.only_document_once = true, .var = "c"});
+
       // Not yet implemented in libsemigroups
       // def_normal_forms<Congruence<Word>>(
       //     m,
@@ -16,20 +16,128 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+// C++ stl headers....
+#include <algorithm>  // for max, min
+#include <cstdint>    // for int64_t, uint64_t
+#include <optional>   // for optional
+#include <vector>     // for vector
+
 // libsemigroups headers
 #include <libsemigroups/dot.hpp>
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/froidure-pin-base.hpp>
 
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_froidure_pin_base
+#include "main.hpp"          // for init_froidure_pin_base
+#include "metrics.hpp"       // for record_metrics, MetricsStream
+#include "packed-words.hpp"  // for make_packed_words_iterator
+#include "runner.hpp"        // for run_releasing_gil, for_each_thread
+#include "trace.hpp"         // for TraceScope
 
 namespace libsemigroups {
   namespace py = pybind11;
 
+  namespace {
+    using positions_array
+        = py::array_t<int64_t, py::array::c_style | py::array::forcecast>;
+
+    // Returns the minimal factorisations of the elements of fp in the given
+    // positions, or of every element of fp if positions is std::nullopt,
+    // packed into a pair of arrays (letters, offsets) as in packed-words.hpp.
+    // If enumerate is true, then fp is enumerated until it contains every
+    // such position (or fully if positions is std::nullopt), and otherwise
+    // every position must be less than fp.current_size().
+    //
+    // The offsets are the partial sums of the lengths of the elements. Every
+    // word is then written backwards by following the prefixes and final
+    // letters from its element, which takes time proportional to the length
+    // of the word. The positions are split into contiguous ranges, one per
+    // thread, since the words are written to disjoint parts of letters.
+    py::tuple minimal_factorisation_many(
+        FroidurePinBase&                      fp,
+        std::optional<positions_array> const& positions,
+        size_t                                threads,
+        bool                                  enumerate,
+        char const*                           name) {
+      int64_t const* pos = nullptr;
+      size_t         n   = 0;
+      if (positions) {
+        if (positions->ndim() != 1) {
+          LIBSEMIGROUPS_EXCEPTION(
+              "expected a 1-dimensional array, found {} dimensions",
+              positions->ndim());
+        }
+        pos = positions->data();
+        n   = static_cast<size_t>(positions->size());
+      }
+      if (enumerate) {
+        if (positions) {
+          int64_t limit = 0;
+          for (size_t i = 0; i < n; ++i) {
+            limit = std::max(limit, pos[i] + 1);
+          }
+          run_releasing_gil(
+              fp, name, [&fp, limit]() { fp.enumerate(limit); });
+        } else {
+          run_releasing_gil(fp, name, [&fp]() { fp.run(); });
+        }
+      }
+      size_t const size = fp.current_size();
+      if (positions) {
+        for (size_t i = 0; i < n; ++i) {
+          if (pos[i] < 0 || static_cast<size_t>(pos[i]) >= size) {
+            LIBSEMIGROUPS_EXCEPTION("expected values in the range [0, {}), "
+                                    "found {} in position {}",
+                                    size,
+                                    pos[i],
+                                    i);
+          }
+        }
+      } else {
+        n = size;
+      }
+      auto position = [pos](size_t i) -> size_t {
+        return pos == nullptr ? i : static_cast<size_t>(pos[i]);
+      };
+
+      py::array_t<uint64_t> offsets(n + 1);
+      uint64_t*             off = offsets.mutable_data();
+      {
+        py::gil_scoped_release release;
+        TraceScope             trace(name);
+        off[0] = 0;
+        for (size_t i = 0; i < n; ++i) {
+          off[i + 1] = off[i] + fp.current_length(position(i));
+        }
+      }
+
+      py::array_t<letter_type> letters(off[n]);
+      letter_type*             out = letters.mutable_data();
+      {
+        py::gil_scoped_release release;
+        TraceScope             trace(name);
+        threads            = std::max(std::min(threads, n), size_t(1));
+        size_t const chunk = (n + threads - 1) / threads;
+        for_each_thread(threads, [&](size_t t) {
+          size_t const last = std::min(n, (t + 1) * chunk);
+          for (size_t i = t * chunk; i < last; ++i) {
+            size_t j = position(i);
+            for (uint64_t k = off[i + 1]; k > off[i]; --k) {
+              out[k - 1] = fp.final_letter(j);
+              j          = fp.prefix(j);
+            }
+          }
+        });
+      }
+      return py::make_tuple(letters, offsets);
+    }
+  }  // namespace
+
   void init_froidure_pin_base(py::module& m) {
     py::class_<FroidurePinBase, Runner> thing(m,
                                               "FroidurePinBase",
@@ -213,10 +321,15 @@ Returns the degree of any and all elements.
   Constant.
 )pbdoc");
 
-    thing.def("enumerate",
-              &FroidurePinBase::enumerate,
-              py::arg("limit"),
-              R"pbdoc(
+    thing.def(
+        "enumerate",
+        [](FroidurePinBase& self, size_t limit) {
+          run_releasing_gil(self, "FroidurePin.enumerate", [&self, limit]() {
+            self.enumerate(limit);
+          });
+        },
+        py::arg("limit"),
+        R"pbdoc(
 :sig=(self: FroidurePin, limit: int) -> None:
 
 Enumerate until at least a specified number of elements are found.
@@ -479,9 +592,13 @@ Returns the fully enumerated right Cayley graph.
 )pbdoc",
               py::return_value_policy::reference_internal);
 
-    thing.def("size",
-              &FroidurePinBase::size,
-              R"pbdoc(
+    thing.def(
+        "size",
+        [](FroidurePinBase& self) {
+          return run_releasing_gil(
+              self, "FroidurePin.size", [&self]() { return self.size(); });
+        },
+        R"pbdoc(
 :sig=(self: FroidurePin) -> int:
 
 Returns the size of the semigroup represented by a :any:`FroidurePin` instance.
@@ -774,6 +891,126 @@ This function returns the short-lex least word (in the generators) representing
         py::arg("fp"),
         py::arg("pos"));
 
+    m.def(
+        "froidure_pin_current_minimal_factorisation_many",
+        [](FroidurePinBase&                      fp,
+           std::optional<positions_array> const& positions,
+           size_t                                number_of_threads) {
+          return minimal_factorisation_many(
+              fp,
+              positions,
+              number_of_threads,
+              false,
+              "froidure_pin.current_minimal_factorisation_many");
+        },
+        py::arg("fp"),
+        py::arg("positions")         = py::none(),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(fp: FroidurePin, positions: numpy.ndarray | None = None, number_of_threads: int = 1) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Returns the short-lex least words representing many elements, packed into
+NumPy arrays.
+
+This function returns a tuple ``(letters, offsets)`` of 1-dimensional NumPy
+arrays, where ``offsets`` has length one more than the number of positions, and
+``letters[offsets[i]:offsets[i + 1]]`` is the value of
+:any:`froidure_pin.current_minimal_factorisation` for *fp* and
+``positions[i]``. If *positions* is ``None``, then the words for every element
+enumerated so far are returned, in the order of their positions.
+
+Every word is found by following the prefixes and final letters of the elements
+of *fp*, and so this function is much faster than calling
+:any:`froidure_pin.current_minimal_factorisation` for every position. The words
+are found in C++ with the GIL released, split between *number_of_threads*
+threads.
+
+:param fp: the :any:`FroidurePin` object.
+:type fp: FroidurePin
+
+:param positions: the positions of the elements, or ``None`` for all elements.
+:type positions: numpy.ndarray | None
+
+:param number_of_threads: the number of threads to use.
+:type number_of_threads: int
+
+:returns: A pair of arrays.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError: if *positions* is not 1-dimensional.
+
+:raises LibsemigroupsError:
+    if any value in *positions* is negative, or not strictly less than
+    :any:`FroidurePin.current_size`.
+
+.. note::
+    No enumeration is triggered by calling this function.
+)pbdoc");
+
+    m.def(
+        "froidure_pin_minimal_factorisation_many",
+        [](FroidurePinBase&                      fp,
+           std::optional<positions_array> const& positions,
+           size_t                                number_of_threads) {
+          return minimal_factorisation_many(
+              fp,
+              positions,
+              number_of_threads,
+              true,
+              "froidure_pin.minimal_factorisation_many");
+        },
+        py::arg("fp"),
+        py::arg("positions")         = py::none(),
+        py::arg("number_of_threads") = 1,
+        R"pbdoc(
+:sig=(fp: FroidurePin, positions: numpy.ndarray | None = None, number_of_threads: int = 1) -> tuple[numpy.ndarray, numpy.ndarray]:
+
+Returns the short-lex least words representing many elements, packed into
+NumPy arrays.
+
+This function returns a tuple ``(letters, offsets)`` of 1-dimensional NumPy
+arrays, where ``offsets`` has length one more than the number of positions, and
+``letters[offsets[i]:offsets[i + 1]]`` is the value of
+:any:`froidure_pin.minimal_factorisation` for *fp* and ``positions[i]``. If
+*positions* is ``None``, then *fp* is fully enumerated, and the words for every
+element are returned, in the order of their positions. Otherwise *fp* is
+enumerated until it contains every position in *positions*.
+
+Every word is found by following the prefixes and final letters of the elements
+of *fp*, and so this function is much faster than calling
+:any:`froidure_pin.minimal_factorisation` for every position. The words are
+found in C++ with the GIL released, split between *number_of_threads* threads.
+
+:param fp: the :any:`FroidurePin` object.
+:type fp: FroidurePin
+
+:param positions: the positions of the elements, or ``None`` for all elements.
+:type positions: numpy.ndarray | None
+
+:param number_of_threads: the number of threads to use.
+:type number_of_threads: int
+
+:returns: A pair of arrays.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError: if *positions* is not 1-dimensional.
+
+:raises LibsemigroupsError:
+    if any value in *positions* is negative, or not strictly less than
+    :any:`FroidurePin.size`.
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import FroidurePin, Transf, froidure_pin
+    >>> S = FroidurePin(Transf([1, 0, 1]), Transf([0, 0, 0]))
+    >>> letters, offsets = froidure_pin.minimal_factorisation_many(S)
+    >>> letters.tolist(), offsets.tolist()
+    ([0, 1, 0, 0, 1, 0], [0, 1, 2, 4, 6])
+    >>> letters, offsets = froidure_pin.minimal_factorisation_many(S, [3, 0])
+    >>> letters.tolist(), offsets.tolist()
+    ([1, 0, 0], [0, 2, 3])
+)pbdoc");
+
     m.def(
         "froidure_pin_current_normal_forms",
         [](FroidurePinBase const& fp) {
@@ -922,6 +1159,180 @@ use :any:`current_rules` instead.
     An iterator yielding rules.
 :rtype:
     collections.abc.Iterator[tuple[list[int], list[int]]]
+)pbdoc");
+
+    m.def(
+        "froidure_pin_normal_forms_chunks",
+        [](FroidurePinBase& fp, size_t batch_size) {
+          run_releasing_gil(
+              fp, "froidure_pin.normal_forms_chunks", [&fp]() { fp.run(); });
+          return make_packed_words_iterator<letter_type>(
+              batch_size,
+              [it   = fp.cbegin_normal_forms(),
+               last = fp.cend_normal_forms()](
+                  std::vector<letter_type>& letters,
+                  std::vector<uint64_t>&    offsets) mutable {
+                if (it == last) {
+                  return false;
+                }
+                append_packed_word(*it, letters, offsets);
+                ++it;
+                return true;
+              });
+        },
+        py::arg("fp"),
+        py::arg("batch_size") = 65'536,
+        py::keep_alive<0, 1>(),
+        R"pbdoc(
+:sig=(fp: FroidurePin, batch_size: int = 65536) -> collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]:
+
+Returns an iterator yielding chunks of normal forms as NumPy arrays.
+
+This function returns an iterator yielding the same normal forms, in the same
+order, as :any:`froidure_pin.normal_forms`, but in chunks of at most
+*batch_size* normal forms. Each chunk is a tuple ``(letters, offsets)`` of
+1-dimensional NumPy arrays, where ``offsets`` has length one more than the
+number of normal forms in the chunk, and the *i*-th normal form in the chunk is
+``letters[offsets[i]:offsets[i + 1]]``. The ``offsets`` always start at ``0``
+in every chunk.
+
+This function performs a full enumeration of *fp*, and every chunk is computed
+in C++ with the GIL released.
+
+:param fp: the :any:`FroidurePin` object.
+:type fp: FroidurePin
+
+:param batch_size: the maximum number of normal forms per chunk.
+:type batch_size: int
+
+:returns: An iterator yielding pairs of arrays.
+:rtype: collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]
+
+:raises LibsemigroupsError: if *batch_size* is ``0``.
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import FroidurePin, Transf, froidure_pin
+    >>> S = FroidurePin(Transf([1, 0, 1]), Transf([0, 0, 0]))
+    >>> list(froidure_pin.normal_forms(S))
+    [[0], [1], [0, 0], [1, 0]]
+    >>> for letters, offsets in froidure_pin.normal_forms_chunks(S, 3):
+    ...     print(letters.tolist(), offsets.tolist())
+    [0, 1, 0, 0] [0, 1, 2, 4]
+    [1, 0] [0, 2]
+)pbdoc");
+
+    m.def(
+        "froidure_pin_rules_chunks",
+        [](FroidurePinBase& fp, size_t batch_size) {
+          run_releasing_gil(
+              fp, "froidure_pin.rules_chunks", [&fp]() { fp.run(); });
+          return make_packed_words_iterator<letter_type>(
+              batch_size,
+              [it = fp.cbegin_rules(), last = fp.cend_rules()](
+                  std::vector<letter_type>& letters,
+                  std::vector<uint64_t>&    offsets) mutable {
+                if (it == last) {
+                  return false;
+                }
+                append_packed_word(it->first, letters, offsets);
+                append_packed_word(it->second, letters, offsets);
+                ++it;
+                return true;
+              });
+        },
+        py::arg("fp"),
+        py::arg("batch_size") = 65'536,
+        py::keep_alive<0, 1>(),
+        R"pbdoc(
+:sig=(fp: FroidurePin, batch_size: int = 65536) -> collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]:
+
+Returns an iterator yielding chunks of rules as NumPy arrays.
+
+This function returns an iterator yielding the same rules, in the same order,
+as :any:`froidure_pin.rules`, but in chunks of at most *batch_size* rules.
+Each chunk is a tuple ``(letters, offsets)`` of 1-dimensional NumPy arrays
+containing the two sides of every rule, one after the other, so that the
+*i*-th rule in the chunk is ``(letters[offsets[2 * i]:offsets[2 * i + 1]],
+letters[offsets[2 * i + 1]:offsets[2 * i + 2]])``. This is the same layout as
+the packed input of, for example, :any:`ToddCoxeter.contains_many`. The
+``offsets`` always start at ``0`` in every chunk.
+
+This function performs a full enumeration of *fp*, and every chunk is computed
+in C++ with the GIL released.
+
+:param fp: the :any:`FroidurePin` object.
+:type fp: FroidurePin
+
+:param batch_size: the maximum number of rules per chunk.
+:type batch_size: int
+
+:returns: An iterator yielding pairs of arrays.
+:rtype: collections.abc.Iterator[tuple[numpy.ndarray, numpy.ndarray]]
+
+:raises LibsemigroupsError: if *batch_size* is ``0``.
+)pbdoc");
+
+    m.def(
+        "runner_current_size_at_least",
+        [](FroidurePinBase const& fp, size_t n) {
+          return StopCondition([&fp, n]() { return fp.current_size() >= n; });
+        },
+        py::arg("fp"),
+        py::arg("n"),
+        py::keep_alive<0, 1>(),
+        R"pbdoc(
+:sig=(fp: FroidurePin, n: int) -> StopCondition:
+
+Returns a condition that is satisfied when a :any:`FroidurePin` instance
+has enumerated a given number of elements.
+
+This function returns a :any:`StopCondition` that is satisfied when
+:any:`FroidurePin.current_size` for *fp* is at least *n*.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param n: the number of elements.
+:type n: int
+
+:returns: A stop condition.
+:rtype: StopCondition
+)pbdoc");
+
+    m.def(
+        "runner_record_metrics",
+        [](FroidurePinBase const& fp, MetricsStream& stream) {
+          return record_metrics(
+              fp, stream, "elements", [](FroidurePinBase const& x) {
+                return x.current_size();
+              });
+        },
+        py::arg("fp"),
+        py::arg("stream"),
+        py::keep_alive<0, 1>(),
+        py::keep_alive<0, 2>(),
+        R"pbdoc(
+:sig=(fp: FroidurePin, stream: MetricsStream) -> StopCondition:
+
+Returns a condition that records samples of the progress of a :any:`FroidurePin`
+instance.
+
+This function returns a :any:`StopCondition` that is never satisfied, but that
+records samples of the progress of *fp* in *stream* while *fp* is running.
+At most once every :any:`MetricsStream.interval`, the value of
+:any:`FroidurePin.current_size` is recorded, with name ``"elements"``.
+The returned condition can be combined with other conditions using ``|``. When
+no sample is due, checking the condition only involves reading the clock.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param stream: the stream where the samples are recorded.
+:type stream: MetricsStream
+
+:returns: A stop condition.
+:rtype: StopCondition
 )pbdoc");
   }  // init_froidure_pin_base
 }  // namespace libsemigroups
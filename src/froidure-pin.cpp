@@ -16,7 +16,11 @@
 // along with this program.  If not, see <http://www.gnu.org/licenses/>.
 //
 
+#include <cstdint>      // for int64_t, uint32_t
+#include <memory>       // for make_shared
 #include <string>
+#include <string_view>  // for string_view
+#include <vector>       // for vector
 
 // libsemigroups headers
 #include <libsemigroups/bipart.hpp>
@@ -28,20 +32,172 @@
 #include <libsemigroups/pbr.hpp>
 #include <libsemigroups/transf.hpp>
 
+#include <fmt/format.h>  // for format
+
 // pybind11....
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <type_traits>
 
 // libsemigroups_pybind11....
 #include "kbe.hpp"
-#include "main.hpp"  // for init_froidure_pin
+#include "main.hpp"            // for init_froidure_pin
+#include "memory.hpp"          // for def_memory_usage, element_memory_usage
+#include "packed-words.hpp"    // for letters_array, unpack_words
+#include "runner.hpp"          // for run_releasing_gil
+#include "serialize.hpp"       // for BinaryWriter
+#include "static-ptransf.hpp"  // for for_each_static_ptransf_degree
+#include "trace.hpp"           // for TraceScope, intern_trace_name
 
 namespace libsemigroups {
   namespace py = pybind11;
 
   namespace {
 
+    ////////////////////////////////////////////////////////////////////////
+    // Bulk lookups
+    ////////////////////////////////////////////////////////////////////////
+
+    // The value used in place of UNDEFINED in the arrays of positions returned
+    // by the *_many functions.
+    constexpr int64_t undefined_position = -1;
+
+    int64_t to_position(size_t pos) {
+      return pos == UNDEFINED ? undefined_position : static_cast<int64_t>(pos);
+    }
+
+    // Returns an array containing f(i) for every i in [0, n). If enumerate is
+    // true, then f may run fp, and so the values are computed using
+    // run_releasing_gil, and otherwise they are computed with the GIL
+    // released.
+    template <typename Result, typename Func>
+    py::array_t<Result> map_releasing_gil(FroidurePinBase& fp,
+                                          char const*      name,
+                                          bool             enumerate,
+                                          size_t           n,
+                                          Func&&           f) {
+      py::array_t<Result> result(n);
+      Result*             out  = result.mutable_data();
+      auto                fill = [&]() {
+        for (size_t i = 0; i < n; ++i) {
+          out[i] = f(i);
+        }
+      };
+      if (enumerate) {
+        run_releasing_gil(fp, name, fill);
+      } else {
+        py::gil_scoped_release release;
+        TraceScope             trace(name);
+        fill();
+      }
+      return result;
+    }
+
+    template <typename Element>
+    using images_array = py::array_t<typename Element::point_type,
+                                     py::array::c_style | py::array::forcecast>;
+
+    // Returns the elements whose images are the rows of the 2-dimensional
+    // array images.
+    template <typename Element>
+    std::vector<Element>
+    elements_from_images(images_array<Element> const& images) {
+      using point_type = typename Element::point_type;
+      if (images.ndim() != 2) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected a 2-dimensional array, found {} dimensions",
+            images.ndim());
+      }
+      size_t const         n   = images.shape(0);
+      size_t const         deg = images.shape(1);
+      point_type const*    row = images.data();
+      std::vector<Element> result;
+      result.reserve(n);
+      py::gil_scoped_release release;
+      for (size_t i = 0; i < n; ++i, row += deg) {
+        result.push_back(
+            make<Element>(std::vector<point_type>(row, row + deg)));
+      }
+      return result;
+    }
+
+    // Define the member function name of FroidurePin<Element>, which returns
+    // an array containing func(self, x) for every x in a list of elements. If
+    // the elements are transformations, partial perms, or permutations, then
+    // the elements can also be given by the rows of a 2-dimensional array of
+    // images. The parameter single is the name of the analogous member
+    // function for a single element, and returns and detail are used in the
+    // doc.
+    template <typename Result, typename Element, typename Func>
+    void def_many(py::class_<FroidurePin<Element>, FroidurePinBase>& thing,
+                  char const* name,
+                  char const* single,
+                  bool        enumerate,
+                  char const* returns,
+                  char const* detail,
+                  Func        func) {
+      using FroidurePin_ = FroidurePin<Element>;
+
+      char const* trace_name
+          = intern_trace_name(fmt::format("FroidurePin.{}", name));
+
+      auto many = [trace_name, enumerate, func](
+                      FroidurePin_& self, std::vector<Element> const& xs) {
+        return map_releasing_gil<Result>(self,
+                                         trace_name,
+                                         enumerate,
+                                         xs.size(),
+                                         [&self, &xs, &func](size_t i) {
+                                           return func(self, xs[i]);
+                                         });
+      };
+
+      thing.def(name,
+                many,
+                py::arg("xs"),
+                fmt::format(R"pbdoc(
+:sig=(self: FroidurePin, xs: list[Element] | numpy.ndarray) -> numpy.ndarray:
+
+Apply :any:`FroidurePin.{0}` to many elements.
+
+This function returns a NumPy array whose *i*-th entry is the value of
+:any:`FroidurePin.{0}` for ``xs[i]``. {2} This is equivalent to, but much
+faster than, calling :any:`FroidurePin.{0}` for every element of *xs*, since
+all of the work is done in C++ with the GIL released.
+
+If the elements of a :any:`FroidurePin` instance are :any:`Transf`,
+:any:`PPerm`, or :any:`Perm` objects, then *xs* can also be a 2-dimensional
+NumPy array of integers, whose rows are the images of the elements. In the rows
+for a :any:`PPerm`, any undefined image should be ``-1``. The elements in such
+an array are constructed without creating any Python objects, and so this is
+faster again.
+
+:param xs: the elements, or their images.
+:type xs: list[Element] | numpy.ndarray
+
+:returns: {1}
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *xs* is an array that is not 2-dimensional, or any of its rows are not
+  the images of a valid element.
+)pbdoc",
+                            single,
+                            returns,
+                            detail)
+                    .c_str());
+
+      if constexpr (IsPTransf<Element>) {
+        thing.def(
+            name,
+            [many](FroidurePin_& self, images_array<Element> const& images) {
+              return many(self, elements_from_images<Element>(images));
+            },
+            py::arg("xs"));
+      }
+    }
+
     // Functionality that doesn't depend on the Element type is bound by this
     // function
     template <typename FroidurePin_>
@@ -438,8 +594,349 @@ full enumeration is triggered by calls to this function.
     :any:`FroidurePin.number_of_generators`.
 
 :complexity: :math:`O(n)` where :math:`n` is the length of the word *w*.)pbdoc");
+
+      m.def(
+          "froidure_pin_current_position_many",
+          [](FroidurePinBase& fpb, std::vector<word_type> const& words) {
+            return map_releasing_gil<int64_t>(
+                fpb,
+                "froidure_pin.current_position_many",
+                false,
+                words.size(),
+                [&fpb, &words](size_t i) {
+                  return to_position(
+                      froidure_pin::current_position(fpb, words[i]));
+                });
+          },
+          py::arg("fp"),
+          py::arg("words"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, words: list[list[int]]) -> numpy.ndarray:
+:only-document-once:
+
+Returns the positions corresponding to many words.
+
+This function returns a NumPy array of ``int64`` whose *i*-th entry is the
+value of :any:`froidure_pin.current_position` for *fp* and ``words[i]``,
+except that :any:`UNDEFINED` is replaced by ``-1``. No enumeration is
+performed, and all of the work is done in C++ with the GIL released.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param words: the words in the generators.
+:type words: list[list[int]]
+
+:returns: The current positions of the elements represented by the words.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+    if any word in *words* contains a value that is not strictly less than
+    :any:`FroidurePin.number_of_generators`.
+)pbdoc");
+
+      m.def(
+          "froidure_pin_current_position_many",
+          [](FroidurePinBase&                fpb,
+             letters_array<word_type> const& letters,
+             offsets_array const&            offsets) {
+            auto words = unpack_words<word_type>(letters, offsets);
+            return map_releasing_gil<int64_t>(
+                fpb,
+                "froidure_pin.current_position_many",
+                false,
+                words.size(),
+                [&fpb, &words](size_t i) {
+                  return to_position(
+                      froidure_pin::current_position(fpb, words[i]));
+                });
+          },
+          py::arg("fp"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, letters: numpy.ndarray, offsets: numpy.ndarray) -> numpy.ndarray:
+:only-document-once:
+
+Returns the positions corresponding to many words packed into arrays.
+
+This function is the same as the other overload of this function, except that
+the words are packed into two arrays, and so no Python object is created for
+any word. The ``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param letters: the letters of all of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns: The current positions of the elements represented by the words.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *offsets* is empty, not non-decreasing, or its last entry is greater
+  than the length of *letters*.
+
+:raises LibsemigroupsError:
+    if any value in *letters* is not strictly less than
+    :any:`FroidurePin.number_of_generators`.
+)pbdoc");
+
+      m.def(
+          "froidure_pin_position_many",
+          [](FroidurePin_& fp, std::vector<word_type> const& words) {
+            return map_releasing_gil<int64_t>(
+                fp,
+                "froidure_pin.position_many",
+                true,
+                words.size(),
+                [&fp, &words](size_t i) {
+                  return to_position(froidure_pin::position(fp, words[i]));
+                });
+          },
+          py::arg("fp"),
+          py::arg("words"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, words: list[list[int]]) -> numpy.ndarray:
+:only-document-once:
+
+Returns the positions corresponding to many words.
+
+This function returns a NumPy array of ``int64`` whose *i*-th entry is the
+value of :any:`froidure_pin.position` for *fp* and ``words[i]``. A full
+enumeration is triggered by calls to this function, and all of the work is
+done in C++ with the GIL released.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param words: the words in the generators.
+:type words: list[list[int]]
+
+:returns: The positions of the elements represented by the words.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+    if any word in *words* contains a value that is not strictly less than
+    :any:`FroidurePin.number_of_generators`.
+)pbdoc");
+
+      m.def(
+          "froidure_pin_position_many",
+          [](FroidurePin_&                   fp,
+             letters_array<word_type> const& letters,
+             offsets_array const&            offsets) {
+            auto words = unpack_words<word_type>(letters, offsets);
+            return map_releasing_gil<int64_t>(
+                fp,
+                "froidure_pin.position_many",
+                true,
+                words.size(),
+                [&fp, &words](size_t i) {
+                  return to_position(froidure_pin::position(fp, words[i]));
+                });
+          },
+          py::arg("fp"),
+          py::arg("letters"),
+          py::arg("offsets"),
+          R"pbdoc(
+:sig=(fp: FroidurePin, letters: numpy.ndarray, offsets: numpy.ndarray) -> numpy.ndarray:
+:only-document-once:
+
+Returns the positions corresponding to many words packed into arrays.
+
+This function is the same as the other overload of this function, except that
+the words are packed into two arrays, and so no Python object is created for
+any word. The ``i``-th word is ``letters[offsets[i]:offsets[i + 1]]``.
+
+:param fp: the :any:`FroidurePin` instance.
+:type fp: FroidurePin
+
+:param letters: the letters of all of the words.
+:type letters: numpy.ndarray
+
+:param offsets: the offsets of the words in *letters*.
+:type offsets: numpy.ndarray
+
+:returns: The positions of the elements represented by the words.
+:rtype: numpy.ndarray
+
+:raises LibsemigroupsError:
+  if *offsets* is empty, not non-decreasing, or its last entry is greater
+  than the length of *letters*.
+
+:raises LibsemigroupsError:
+    if any value in *letters* is not strictly less than
+    :any:`FroidurePin.number_of_generators`.
+)pbdoc");
+
+      // Every element is stored once, with one entry in a hash map, and the
+      // left and right Cayley graphs, and several other arrays, have one row
+      // (or value) per element. All elements are assumed to use the same
+      // amount of memory as the first generator.
+      def_memory_usage(thing, "FroidurePin", [](FroidurePin_ const& fp) {
+        size_t const n = fp.number_of_generators();
+        if (n == 0) {
+          return size_t(0);
+        }
+        size_t const bytes_per_element
+            = element_memory_usage(fp.generator(0)) + 3 * sizeof(void*)
+              + (2 * n + 6) * sizeof(uint32_t);
+        return fp.current_size() * bytes_per_element;
+      });
     }  // bind_froidure_pin_core
 
+    ////////////////////////////////////////////////////////////////////////
+    // Snapshots
+    ////////////////////////////////////////////////////////////////////////
+
+    // The layout of a snapshot file is: the 4 byte magic string, the 4 byte
+    // version, and the 72 byte header below, followed by the generators, the
+    // elements, the right and left Cayley graphs, the prefix, suffix, first
+    // letter, final letter, and length arrays, and, if the enumeration is
+    // finished, the sorted positions. Every section starts
+    // at a multiple of 8 bytes, so that it can be memory mapped. Each element
+    // is stored as degree values of point_bytes bytes each, and all of the
+    // other values are 32-bit unsigned integers.
+    //
+    // The function froidure_pin.snapshot_arrays in froidure_pin.py must be
+    // kept in sync with this layout.
+    constexpr char     froidure_pin_snapshot_magic[5] = "LSFP";
+    constexpr uint32_t froidure_pin_snapshot_version  = 2;
+
+    struct FroidurePinSnapshotHeader {
+      char     element_type[32];
+      uint64_t degree;
+      uint64_t point_bytes;
+      uint64_t number_of_generators;
+      uint64_t size;
+      uint64_t finished;
+    };
+
+    static_assert(sizeof(FroidurePinSnapshotHeader) == 72);
+
+    // Returns true if name, and a terminating null byte, fit in the field
+    // element_type of a FroidurePinSnapshotHeader.
+    constexpr bool fits_in_snapshot_header(std::string_view name) {
+      return name.size() < sizeof(FroidurePinSnapshotHeader::element_type);
+    }
+
+    // The longest names of the types of elements that support snapshots, see
+    // init_froidure_pin.
+    static_assert(fits_in_snapshot_header("HPCombiPTransf16"));
+    static_assert(fits_in_snapshot_header("StaticTransf32"));
+
+    template <typename Element>
+    constexpr bool supports_snapshot
+        = std::is_trivially_copyable_v<Element> || IsPTransf<Element>;
+
+    // Returns the number of values of point_type used to store x.
+    template <typename Element>
+    size_t snapshot_degree(Element const& x) {
+      if constexpr (std::is_trivially_copyable_v<Element>) {
+        return sizeof(Element);
+      } else {
+        return x.degree();
+      }
+    }
+
+    // Elements of trivially copyable types are stored as their bytes, and
+    // transformations as their images.
+    template <typename Element, typename = void>
+    struct SnapshotPoint {
+      using type = uint8_t;
+    };
+
+    template <typename Element>
+    struct SnapshotPoint<
+        Element,
+        std::enable_if_t<!std::is_trivially_copyable_v<Element>>> {
+      using type = typename Element::point_type;
+    };
+
+    template <typename Element>
+    using snapshot_point_type = typename SnapshotPoint<Element>::type;
+
+    template <typename Element>
+    void write_snapshot_element(BinaryWriter& out, Element const& x) {
+      if constexpr (std::is_trivially_copyable_v<Element>) {
+        out.write(x);
+      } else {
+        std::vector<snapshot_point_type<Element>> points(x.begin(), x.end());
+        out.write_bytes(points.data(),
+                        points.size() * sizeof(snapshot_point_type<Element>));
+      }
+    }
+
+    // Writes n values of f(i) for i in [0, n) as 32-bit integers.
+    template <typename Func>
+    void write_snapshot_array(BinaryWriter& out, size_t n, Func&& f) {
+      std::vector<uint32_t> values(n);
+      for (size_t i = 0; i < n; ++i) {
+        values[i] = static_cast<uint32_t>(f(i));
+      }
+      out.write_bytes(values.data(), n * sizeof(uint32_t));
+      out.align(8);
+    }
+
+    template <typename Element>
+    void save_snapshot(FroidurePin<Element>& fp,
+                       std::string const&    name,
+                       std::string const&    filename) {
+      size_t const n    = fp.current_size();
+      size_t const k    = fp.number_of_generators();
+      size_t const deg  = k == 0 ? 0 : snapshot_degree(fp.generator(0));
+      auto const&  wg_r = fp.current_right_cayley_graph();
+      auto const&  wg_l = fp.current_left_cayley_graph();
+
+      if (!fits_in_snapshot_header(name)) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the name of the element type \"{}\" is too long for a snapshot",
+            name);
+      }
+      BinaryWriter out(
+          filename, froidure_pin_snapshot_magic, froidure_pin_snapshot_version);
+      FroidurePinSnapshotHeader header{};
+      name.copy(header.element_type, sizeof(header.element_type) - 1);
+      header.degree               = deg;
+      header.point_bytes          = sizeof(snapshot_point_type<Element>);
+      header.number_of_generators = k;
+      header.size                 = n;
+      header.finished             = fp.finished();
+      out.write(header);
+
+      for (size_t i = 0; i < k; ++i) {
+        write_snapshot_element(out, fp.generator(i));
+      }
+      out.align(8);
+      for (auto it = fp.begin(); it != fp.end(); ++it) {
+        write_snapshot_element(out, *it);
+      }
+      out.align(8);
+      write_snapshot_array(out, n * k, [&wg_r, k](size_t i) {
+        return wg_r.target_no_checks(i / k, i % k);
+      });
+      write_snapshot_array(out, n * k, [&wg_l, k](size_t i) {
+        return wg_l.target_no_checks(i / k, i % k);
+      });
+      write_snapshot_array(out, n, [&fp](size_t i) { return fp.prefix(i); });
+      write_snapshot_array(out, n, [&fp](size_t i) { return fp.suffix(i); });
+      write_snapshot_array(
+          out, n, [&fp](size_t i) { return fp.first_letter(i); });
+      write_snapshot_array(
+          out, n, [&fp](size_t i) { return fp.final_letter(i); });
+      write_snapshot_array(
+          out, n, [&fp](size_t i) { return fp.current_length(i); });
+      if (fp.finished()) {
+        write_snapshot_array(
+            out, n, [&fp](size_t i) { return fp.to_sorted_position(i); });
+      }
+      out.close();
+    }
+
     template <typename Element>
     void bind_froidure_pin_stateless(py::module& m, std::string const& name) {
       using FroidurePin_ = FroidurePin<Element>;
@@ -486,6 +983,90 @@ terminating presentation :any:`froidure_pin.rules` for the semigroup is known.
 
       bind_froidure_pin_core(m, thing);
 
+      def_many<bool>(
+          thing,
+          "contains_many",
+          "contains",
+          true,
+          "An array of ``bool`` of the same length as *xs*.",
+          "The :any:`FroidurePin` instance is enumerated as far as necessary.",
+          [](FroidurePin_& self, Element const& x) {
+            return self.contains(x);
+          });
+
+      def_many<int64_t>(
+          thing,
+          "current_position_many",
+          "current_position",
+          false,
+          "An array of ``int64`` of the same length as *xs*.",
+          "No enumeration is triggered, and :any:`UNDEFINED` is replaced by "
+          "``-1``.",
+          [](FroidurePin_& self, Element const& x) {
+            return to_position(self.current_position(x));
+          });
+
+      def_many<int64_t>(
+          thing,
+          "position_many",
+          "position",
+          true,
+          "An array of ``int64`` of the same length as *xs*.",
+          "The :any:`FroidurePin` instance is enumerated as far as necessary, "
+          "and :any:`UNDEFINED` is replaced by ``-1``.",
+          [](FroidurePin_& self, Element const& x) {
+            return to_position(self.position(x));
+          });
+
+      def_many<int64_t>(
+          thing,
+          "sorted_position_many",
+          "sorted_position",
+          true,
+          "An array of ``int64`` of the same length as *xs*.",
+          "A full enumeration is triggered, and :any:`UNDEFINED` is replaced "
+          "by ``-1``.",
+          [](FroidurePin_& self, Element const& x) {
+            return to_position(self.sorted_position(x));
+          });
+
+      if constexpr (supports_snapshot<Element>) {
+        thing.def(
+            "save_snapshot",
+            [name](FroidurePin_& self, std::string const& filename) {
+              save_snapshot(self, name, filename);
+            },
+            py::arg("filename"),
+            R"pbdoc(
+:sig=(self: FroidurePin, filename: str) -> None:
+
+Save a snapshot of the enumeration to a file.
+
+This function writes the generators, the so-far enumerated elements, the
+current left and right Cayley graphs, the prefixes, suffixes, first and final
+letters, and lengths of the so-far enumerated elements, and, if the enumeration
+is finished, the sorted positions of the elements, to the file *filename*. This
+function does not trigger any enumeration, and so can be used to save the state
+of a partially enumerated instance.
+
+The data in the snapshot can be memory mapped as NumPy arrays without being
+parsed using :any:`froidure_pin.snapshot_arrays`. This is the only way of
+reading a snapshot: ``libsemigroups`` provides no way of installing the data
+in a :any:`FroidurePin` instance, and so a :any:`FroidurePin` instance cannot
+be restored from a snapshot, and an enumeration cannot be resumed from one.
+Snapshots are written in the native byte order, and so can only be read on
+platforms with the same byte order.
+
+Snapshots are only supported when ``Element`` is a transformation, partial
+perm, permutation, or a type with a fixed size, such as :any:`BMat8`.
+
+:param filename: the name of the file.
+:type filename: str
+
+:raises LibsemigroupsError: if the file cannot be written.
+)pbdoc");
+      }
+
       // thing.attr("Element") = py::class_<Element>(m);
       thing.def("__getitem__", &FroidurePin_::at, py::is_operator());
       thing.def("__iter__", [](FroidurePin_& self) {
@@ -712,10 +1293,16 @@ or number of idempotents, for example.
     if the elements in *gens* do not all have the same degree.
 )pbdoc");
 
-      thing.def("contains",
-                &FroidurePin_::contains,
-                py::arg("x"),
-                R"pbdoc(
+      thing.def(
+          "contains",
+          [](FroidurePin_& self, Element const& x) {
+            return run_releasing_gil(
+                self, "FroidurePin.contains", [&self, &x]() {
+                  return self.contains(x);
+                });
+          },
+          py::arg("x"),
+          R"pbdoc(
 :sig=(self: FroidurePin, x: Element) -> bool:
 
 Test membership of an element.
@@ -856,7 +1443,12 @@ in the same state as if it had just been constructed from *gens*.
 
       thing.def(
           "position",
-          [](FroidurePin_& self, Element const& x) { return self.position(x); },
+          [](FroidurePin_& self, Element const& x) {
+            return run_releasing_gil(
+                self, "FroidurePin.position", [&self, &x]() {
+                  return self.position(x);
+                });
+          },
           py::arg("x"),
           R"pbdoc(
 :sig=(self: FroidurePin, x: Element) -> int | Undefined:
@@ -1123,11 +1715,17 @@ This function returns the element of *fp* obtained by evaluating *w*.
         thing.def(
             "contains",
             [](FroidurePin_& self, ElementStateful<FroidurePin_> const& x) {
-              return self.contains(to_element(x));
+              return run_releasing_gil(
+                  self, "FroidurePin.contains", [&self, &x]() {
+                    return self.contains(to_element(x));
+                  });
             });
 
         thing.def("contains", [](FroidurePin_& self, Word const& x) {
-          return self.contains(to_element(self, x));
+          auto y = to_element(self, x);
+          return run_releasing_gil(self, "FroidurePin.contains", [&self, &y]() {
+            return self.contains(y);
+          });
         });
 
         thing.def("copy_add_generators",
@@ -1289,6 +1887,16 @@ This function returns the element of *fp* obtained by evaluating *w*.
     bind_froidure_pin_stateless<Perm<0, uint16_t>>(m, "Perm2");
     bind_froidure_pin_stateless<Perm<0, uint32_t>>(m, "Perm4");
 
+    for_each_static_ptransf_degree([&m](auto n) {
+      constexpr size_t N = decltype(n)::value;
+      bind_froidure_pin_stateless<Transf<N, uint8_t>>(
+          m, static_ptransf_name("Transf", N));
+      bind_froidure_pin_stateless<PPerm<N, uint8_t>>(
+          m, static_ptransf_name("PPerm", N));
+      bind_froidure_pin_stateless<Perm<N, uint8_t>>(
+          m, static_ptransf_name("Perm", N));
+    });
+
     bind_froidure_pin_stateless<Bipartition>(m, "Bipartition");
     bind_froidure_pin_stateless<PBR>(m, "PBR");
 
@@ -131,6 +131,7 @@ raised.)pbdoc"sv;
 )pbdoc"sv;
 
       def_contains(thing, "Kambites", doc{.raises = extra_raises});
+      def_contains_many(thing, "Kambites", doc{.raises = extra_raises});
 
       extra_detail = R"pbdoc(If the :any:`Kambites.small_overlap_class`
 is not at least :math:`4`, then an exception is thrown.)pbdoc"sv;
@@ -140,6 +141,9 @@ is not at least :math:`4`, then an exception is thrown.)pbdoc"sv;
       def_reduce(thing,
                  "Kambites",
                  doc{.detail = extra_detail, .raises = extra_raises});
+      def_reduce_many(thing,
+                      "Kambites",
+                      doc{.detail = extra_detail, .raises = extra_raises});
 
       ////////////////////////////////////////////////////////////////////////
       // Kambites specific stuff
@@ -218,12 +222,24 @@ is used to determine the pieces, and decompositions of the relation words.
           "kambites",
           doc{.only_document_once = true, .raises = extra_raises, .var = "k"});
 
+      def_partition_ids<Kambites_>(
+          m,
+          "Kambites",
+          "kambites",
+          doc{.only_document_once = true, .raises = extra_raises, .var = "k"});
+
       def_normal_forms<Kambites_>(
           m,
           "Kambites",
           "kambites",
           doc{.only_document_once = true, .raises = extra_raises, .var = "k"});
 
+      def_normal_forms_chunks<Kambites_>(
+          m,
+          "Kambites",
+          "kambites",
+          doc{.only_document_once = true, .raises = extra_raises, .var = "k"});
+
       // No prefix because not in a subpackage
       m.def(
           "is_obviously_infinite",
@@ -39,6 +39,9 @@
 // libsemigroups_pybind11....
 #include "cong-common.hpp"  // for contains etc
 #include "main.hpp"         // for init_detail_knuth_bendix_impl
+#include "memory.hpp"       // for def_memory_usage
+#include "metrics.hpp"      // for record_metrics, MetricsStream
+#include "runner.hpp"       // for StopCondition
 
 // TODO(2): remove unused doc from this file.
 
@@ -120,9 +123,29 @@ The valid values are:
       def_number_of_classes(thing, "KnuthBendix");
       def_add_generating_pair(thing, "KnuthBendix");
       def_contains(thing, "KnuthBendix");
+      def_contains_many(thing, "KnuthBendix");
       def_currently_contains(thing, "KnuthBendix");
       def_reduce_no_run(thing, "KnuthBendix");
       def_reduce(thing, "KnuthBendix");
+      def_reduce_many(thing, "KnuthBendix");
+
+      // The lengths of the rules are not available without processing any
+      // pending rules, and so the average length of the rules in the
+      // presentation is used as an estimate. Inactive rules are not freed.
+      def_memory_usage(
+          thing, "KnuthBendix", [](KnuthBendixImpl<Rewriter> const& kb) {
+            auto const& p       = kb.internal_presentation();
+            size_t      letters = 0;
+            for (auto const& w : p.rules) {
+              letters += w.size();
+            }
+            size_t const avg_len
+                = p.rules.empty() ? 1 : 1 + letters / p.rules.size();
+            size_t const bytes_per_rule = 2 * sizeof(std::string)
+                                          + 4 * sizeof(void*) + 2 * avg_len;
+            return (kb.number_of_active_rules() + kb.number_of_inactive_rules())
+                   * bytes_per_rule;
+          });
 
       // Not exposed in the doc
       thing.def("internal_presentation",
@@ -501,6 +524,71 @@ infinite; ``False`` is returned if it is not.
     If this function returns ``False``, it is still possible that the
     quotient defined by the :py:class:`KnuthBendix`
     object *kb* is infinite.
+)pbdoc");
+
+      m.def(
+          "runner_number_of_active_rules_at_least",
+          [](KnuthBendixImpl<Rewriter> const& kb, size_t n) {
+            return StopCondition(
+                [&kb, n]() { return kb.number_of_active_rules() >= n; });
+          },
+          py::arg("kb"),
+          py::arg("n"),
+          py::keep_alive<0, 1>(),
+          R"pbdoc(
+:sig=(kb: KnuthBendix, n: int) -> StopCondition:
+:only-document-once:
+
+Returns a condition that is satisfied when a :any:`KnuthBendix` instance has
+a given number of active rules.
+
+This function returns a :any:`StopCondition` that is satisfied when
+:any:`KnuthBendix.number_of_active_rules` for *kb* is at least *n*.
+
+:param kb: the :any:`KnuthBendix` instance.
+:type kb: KnuthBendix
+
+:param n: the number of rules.
+:type n: int
+
+:returns: A stop condition.
+:rtype: StopCondition
+)pbdoc");
+
+      m.def(
+          "runner_record_metrics",
+          [](KnuthBendixImpl<Rewriter> const& kb, MetricsStream& stream) {
+            return record_metrics(
+                kb, stream, "rules", [](KnuthBendixImpl<Rewriter> const& x) {
+                  return x.number_of_active_rules();
+                });
+          },
+          py::arg("kb"),
+          py::arg("stream"),
+          py::keep_alive<0, 1>(),
+          py::keep_alive<0, 2>(),
+          R"pbdoc(
+:sig=(kb: KnuthBendix, stream: MetricsStream) -> StopCondition:
+:only-document-once:
+
+Returns a condition that records samples of the progress of a
+:any:`KnuthBendix` instance.
+
+This function returns a :any:`StopCondition` that is never satisfied, but that
+records samples of the progress of *kb* in *stream* while *kb* is running.
+At most once every :any:`MetricsStream.interval`, the value of
+:any:`KnuthBendix.number_of_active_rules` is recorded, with name ``"rules"``.
+The returned condition can be combined with other conditions using ``|``. When
+no sample is due, checking the condition only involves reading the clock.
+
+:param kb: the :any:`KnuthBendix` instance.
+:type kb: KnuthBendix
+
+:param stream: the stream where the samples are recorded.
+:type stream: MetricsStream
+
+:returns: A stop condition.
+:rtype: StopCondition
 )pbdoc");
     }
   }  // namespace detail
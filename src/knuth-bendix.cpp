@@ -102,6 +102,7 @@ nested class :any:`KnuthBendix.options`.
       def_add_generating_pair(thing, "KnuthBendix");
       def_currently_contains(thing, "KnuthBendix");
       def_contains(thing, "KnuthBendix");
+      def_contains_many(thing, "KnuthBendix");
 
       auto extra_detail = R"pbdoc(
 Otherwise, this function returns the word *w* rewritten according to
@@ -110,6 +111,7 @@ the current rules in the :py:class:`KnuthBendix` instance.
 
       def_reduce_no_run(thing, "KnuthBendix", doc{.detail = extra_detail});
       def_reduce(thing, "KnuthBendix");
+      def_reduce_many(thing, "KnuthBendix");
 
       thing.def(
           "active_rules",
@@ -165,6 +167,12 @@ unique prefixes of the left-hand sides of the rules of the rewriting system.
           "knuth_bendix",
           doc{.only_document_once = true, .var = "kb"});
 
+      def_partition_ids<KnuthBendix_>(
+          m,
+          "KnuthBendix",
+          "knuth_bendix",
+          doc{.only_document_once = true, .var = "kb"});
+
       ////////////////////////////////////////////////////////////////////////
       // Helper functions - specific to KnuthBendix
       ////////////////////////////////////////////////////////////////////////
@@ -213,6 +221,18 @@ construct *kb*. This function triggers a full enumeration of *kb*.
     ['a', 'b', 'c', 'aa', 'ab', 'ac', 'ba', 'bb', 'bc', 'ca', 'cb', 'cc']
 )pbdoc");
 
+      def_normal_forms_chunks<KnuthBendix_>(m,
+                                            "KnuthBendix",
+                                            "knuth_bendix",
+                                            doc{.detail = R"pbdoc(
+This function triggers a full enumeration of *kb*.
+
+.. warning::
+    Termination of the Knuth-Bendix algorithm is undecidable in general, and
+    this function may never terminate.)pbdoc",
+                                                .only_document_once = true,
+                                                .var = "kb"});
+
       m.def(
           "knuth_bendix_by_overlap_length",
           [](KnuthBendix_& kb) { knuth_bendix::by_overlap_length(kb); },
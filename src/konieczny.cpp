@@ -30,7 +30,10 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11. ..  .
-#include "main.hpp"  // for init_konieczny
+#include "main.hpp"            // for init_konieczny
+#include "memory.hpp"          // for def_memory_usage, element_memory_usage
+#include "runner.hpp"          // for run_releasing_gil
+#include "static-ptransf.hpp"  // for for_each_static_ptransf_degree
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -295,6 +298,23 @@ Returns the current number of :math:`\mathscr{H}`-classes.
 :rtype:
    int
 )pbdoc");
+      // For every L-class and R-class, a representative, and a left or
+      // right multiplier and its inverse are stored, and the elements of every
+      // H-class representative are stored. All elements are assumed to use
+      // the same amount of memory as the first generator.
+      def_memory_usage(thing, "Konieczny", [](Konieczny_& k) {
+        if (k.cbegin_generators() == k.cend_generators()) {
+          return size_t(0);
+        }
+        size_t const bytes_per_element
+            = element_memory_usage(*k.cbegin_generators()) + sizeof(void*);
+        return (3
+                    * (k.current_number_of_L_classes()
+                       + k.current_number_of_R_classes())
+                + k.current_number_of_H_classes())
+               * bytes_per_element;
+      });
+
       thing.def("current_number_of_idempotents",
                 &Konieczny_::current_number_of_idempotents,
                 R"pbdoc(
@@ -590,9 +610,13 @@ Returns the number of regular :math:`\mathscr{R}`-classes.
 :rtype:
    int
 )pbdoc");
-      thing.def("size",
-                &Konieczny_::size,
-                R"pbdoc(
+      thing.def(
+          "size",
+          [](Konieczny_& self) {
+            return run_releasing_gil(
+                self, "Konieczny.size", [&self]() { return self.size(); });
+          },
+          R"pbdoc(
 :sig=(self: Konieczny) -> int:
 
 Returns the size.
@@ -761,6 +785,12 @@ not already known.
     bind_konieczny<PPerm<0, uint32_t>>(m, "PPerm4");
     bind_konieczny<MaxPlusTruncMat<0, 0, 0, int64_t>>(m, "MaxPlusTruncMat");
 
+    for_each_static_ptransf_degree([&m](auto n) {
+      constexpr size_t N = decltype(n)::value;
+      bind_konieczny<Transf<N, uint8_t>>(m, static_ptransf_name("Transf", N));
+      bind_konieczny<PPerm<N, uint8_t>>(m, static_ptransf_name("PPerm", N));
+    });
+
 #ifdef LIBSEMIGROUPS_HPCOMBI_ENABLED
     bind_konieczny<HPCombi::PTransf16>(m, "HPCombiPTransf16");
     bind_konieczny<HPCombi::Transf16>(m, "HPCombiTransf16");
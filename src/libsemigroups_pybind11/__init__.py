@@ -26,6 +26,7 @@ from . import (
     paths,
     pbr,
     presentation,
+    runner,
     schreier_sims,
     sims,
     stephen,
@@ -70,6 +71,7 @@ from .order import (
     WtLexCmp,
 )
 from .presentation import InversePresentation, Presentation
+from .runner import StopCondition
 from .schreier_sims import SchreierSims
 from .sims import MinimalRepOrc, RepOrc, Sims1, Sims2, SimsRefinerFaithful, SimsRefinerIdeals
 from .stephen import Stephen
@@ -110,7 +112,10 @@ try:
         Reporter,
         ReportGuard,
         Runner,
+        SimsPredicate,
+        SimsResultQueue,
         SimsStats,
+        SimsThreadStats,
         StringRange,
         ToString,
         ToWord,
@@ -208,7 +213,10 @@ __all__ = [
     "Reporter",
     "ReportGuard",
     "Runner",
+    "SimsPredicate",
+    "SimsResultQueue",
     "SimsStats",
+    "SimsThreadStats",
     "StringRange",
     "ToString",
     "ToWord",
@@ -264,6 +272,7 @@ __all__ = [
     "paths",
     "pbr",
     "presentation",
+    "runner",
     "schreier_sims",
     "sims",
     "stephen",
@@ -304,6 +313,7 @@ __all__ = [
     "SimsRefinerFaithful",
     "SimsRefinerIdeals",
     "Stephen",
+    "StopCondition",
     "ToddCoxeter",
     "Transf",
     # Free functions from submodules
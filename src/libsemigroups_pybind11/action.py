@@ -9,6 +9,7 @@ contains helper functions for the :any:`Action` class.
 """
 
 from collections.abc import Iterator
+from functools import update_wrapper as _update_wrapper
 from typing import TypeVar as _TypeVar
 
 from typing_extensions import Self as _Self
@@ -50,6 +51,7 @@ from .detail.cxx_wrapper import (
     to_py as _to_py,
 )
 from .detail.decorators import copydoc as _copydoc
+from .transf import _to_dynamic_cxx
 
 ########################################################################
 # Action python class
@@ -150,8 +152,10 @@ class Action(_CxxWrapper):
                 "seed, more seeds can be added later using Action.add_seed"
             )
 
-        generators = [_to_cxx(x) for x in generators]
-        seeds = [_to_cxx(x) for x in seeds]
+        # Actions are only defined for transformations, partial perms, and
+        # permutations of dynamic degree
+        generators = [_to_dynamic_cxx(x) for x in generators]
+        seeds = [_to_dynamic_cxx(x) for x in seeds]
         self.py_template_params = (type(generators[0]), type(seeds[0]), func, side)
         self.init_cxx_obj()
         for x in generators:
@@ -184,6 +188,20 @@ class Action(_CxxWrapper):
 
 _copy_cxx_mem_fns(_RightActionPPerm1PPerm1, Action)
 
+
+def _convert_args(mem_fn):
+    # Actions are only defined for transformations, partial perms, and
+    # permutations of dynamic degree, see _to_dynamic_cxx.
+    def wrapper(self, *args):
+        return mem_fn(self, *(_to_dynamic_cxx(x) for x in args))
+
+    _update_wrapper(wrapper, mem_fn)
+    return wrapper
+
+
+for _name in ("add_generator", "add_seed", "apply", "position", "root_of_scc"):
+    setattr(Action, _name, _convert_args(getattr(Action, _name)))
+
 for _type in (
     Action._py_template_params_to_cxx_type.values()  # pylint: disable=protected-access
 ):
@@ -32,6 +32,7 @@ from .detail.cxx_wrapper import (
     to_py as _to_py,
 )
 from .detail.decorators import copydoc as _copydoc
+from .transf import _to_dynamic_cxx
 
 ########################################################################
 # The ImageAction protected class
@@ -61,11 +62,12 @@ class _ImageAction(_CxxWrapper):
             return
         if len(args) != 0:
             raise TypeError(f"expected 0 positional arguments, but found {len(args)}")
-        self.py_template_params = (type(_to_cxx(element)), type(_to_cxx(point)))
+        # The adapters are only defined for partial perms of dynamic degree
+        self.py_template_params = (type(_to_dynamic_cxx(element)), type(_to_dynamic_cxx(point)))
         self.init_cxx_obj()
 
     def __call__(self: _Self, *args):
-        return _to_py(_to_cxx(self)(*(_to_cxx(x) for x in args)))
+        return _to_py(_to_cxx(self)(*(_to_dynamic_cxx(x) for x in args)))
 
 
 ########################################################################
@@ -97,7 +99,7 @@ class ImageRightAction(_ImageAction):
 
     @_copydoc(_ImageRightActionPPerm1PPerm1.__call__)
     def __call__(self: _Self, pt: Point, x: Element) -> Point:
-        return _to_py(_to_cxx(self)(_to_cxx(pt), _to_cxx(x)))
+        return _to_py(_to_cxx(self)(_to_dynamic_cxx(pt), _to_dynamic_cxx(x)))
 
 
 ########################################################################
@@ -140,7 +142,7 @@ class ImageLeftAction(_ImageAction):
 
     @_copydoc(_ImageLeftActionPPerm1PPerm1.__call__)
     def __call__(self: _Self, pt: Point, x: Element) -> Point:
-        return _to_py(_to_cxx(self)(_to_cxx(pt), _to_cxx(x)))
+        return _to_py(_to_cxx(self)(_to_dynamic_cxx(pt), _to_dynamic_cxx(x)))
 
 
 __all__ = ["ImageLeftAction", "ImageRightAction"]
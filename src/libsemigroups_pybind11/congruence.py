@@ -16,6 +16,7 @@ from _libsemigroups_pybind11 import (
     CongruenceWord as _CongruenceWord,
     congruence_non_trivial_classes as _congruence_non_trivial_classes,
     congruence_partition as _congruence_partition,
+    congruence_partition_ids as _congruence_partition_ids,
 )
 
 from .detail.congruence_common import CongruenceCommon as _CongruenceCommon
@@ -127,6 +128,7 @@ _register_cxx_wrapped_type(_CongruenceWord, Congruence)
 _register_cxx_wrapped_type(_CongruenceString, Congruence)
 
 partition = _wrap_cxx_free_fn(_congruence_partition)
+partition_ids = _wrap_cxx_free_fn(_congruence_partition_ids)
 non_trivial_classes = _wrap_cxx_free_fn(_congruence_non_trivial_classes)
 
-__all__ = ["Congruence", "partition", "non_trivial_classes"]
+__all__ = ["Congruence", "partition", "partition_ids", "non_trivial_classes"]
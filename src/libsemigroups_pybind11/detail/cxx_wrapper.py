@@ -162,11 +162,13 @@ def wrap_cxx_mem_fn(cxx_mem_fn: Pybind11Type) -> Callable:
     <cxx_mem_fn> to the returned function.
     """
 
-    def cxx_mem_fn_wrapper(self, *args):
+    def cxx_mem_fn_wrapper(self, *args, **kwargs):
         # TODO(1) move the first if-clause into to_cxx?
         if len(args) == 1 and isinstance(args[0], list):
             args = [[to_cxx(x) for x in args[0]]]
-        result = getattr(to_cxx(self), cxx_mem_fn.__name__)(*(to_cxx(x) for x in args))
+        result = getattr(to_cxx(self), cxx_mem_fn.__name__)(
+            *(to_cxx(x) for x in args), **{k: to_cxx(v) for k, v in kwargs.items()}
+        )
         if result is to_cxx(self):
             return self
         if type(result) in _CXX_WRAPPED_TYPE_TO_PY_TYPE:
@@ -0,0 +1,129 @@
+# Copyright (c) 2025 J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+"""This module provides some tools for the C++ types of transformations, partial
+perms, and permutations whose degree is fixed at compile time, and the C++
+types of the algorithms that are instantiated for them; see
+static-ptransf.hpp.
+"""
+
+from collections.abc import Callable
+from functools import update_wrapper
+from typing import Any
+
+import _libsemigroups_pybind11
+from _libsemigroups_pybind11 import STATIC_PTRANSF_DEGREES, LibsemigroupsError
+
+from .cxx_wrapper import to_cxx
+
+
+def static_cxx_types(name: str) -> dict:
+    """Returns a dictionary mapping the py_template_params ``(2**8, n)`` to the
+    C++ type ``Static<name><n>`` for every static degree ``n``, where *name* is
+    one of ``"Transf"``, ``"PPerm"``, or ``"Perm"``.
+    """
+    return {
+        (2**8, n): getattr(_libsemigroups_pybind11, f"Static{name}{n}")
+        for n in STATIC_PTRANSF_DEGREES
+    }
+
+
+def static_cxx_algorithm_types(
+    prefix: str, suffix: str = "", names: tuple[str, ...] = ("Transf", "PPerm", "Perm")
+) -> dict:
+    """Returns a dictionary mapping ``(T,)`` to the C++ type with name
+    ``prefix + T.__name__ + suffix`` for every C++ type ``T`` returned by
+    :py:func:`static_cxx_types` for some name in *names*. For example, if
+    *prefix* is ``"FroidurePin"``, then the values include
+    ``FroidurePinStaticTransf2``.
+    """
+    return {
+        (cxx_type,): getattr(_libsemigroups_pybind11, f"{prefix}{cxx_type.__name__}{suffix}")
+        for name in names
+        for cxx_type in static_cxx_types(name).values()
+    }
+
+
+# The kind (such as "Transf") and py_template_params of the C++ type of every
+# transformation, partial perm, and permutation.
+_KIND_AND_PARAMS = {
+    getattr(_libsemigroups_pybind11, f"{kind}{k}"): (kind, (2 ** (8 * k),))
+    for kind in ("Transf", "PPerm", "Perm")
+    for k in (1, 2, 4)
+} | {
+    cxx_type: (kind, params)
+    for kind in ("Transf", "PPerm", "Perm")
+    for params, cxx_type in static_cxx_types(kind).items()
+}
+
+
+def to_element_cxx(cxx_type: Any, x: Any) -> Any:
+    """Returns the C++ object wrapped by *x*, converted to *cxx_type* if *x* is
+    a transformation, partial perm, or permutation of the same kind as
+    *cxx_type*, but of a different C++ type. Returns ``None`` if *cxx_type* has
+    static degree, and the degree of *x* is different.
+
+    Objects of the same kind, and even of the same degree, can have different
+    C++ types (for example, the elements of a FroidurePin object returned by
+    :any:`to` have dynamic degree), and pybind11 would raise a TypeError if
+    such an *x* was passed to a C++ function expecting *cxx_type*.
+    """
+    x = to_cxx(x)
+    if type(x) is cxx_type or cxx_type not in _KIND_AND_PARAMS or type(x) not in _KIND_AND_PARAMS:
+        return x
+    kind, params = _KIND_AND_PARAMS[cxx_type]
+    if _KIND_AND_PARAMS[type(x)][0] != kind:
+        return x
+    if len(params) == 2 and x.degree() != params[1]:
+        return None
+    if len(params) == 1 and x.degree() > params[0]:
+        return x
+    return cxx_type(list(x.images()))
+
+
+def to_element_cxxs(cxx_type: Any, xs: list) -> list:
+    """Returns the list of :py:func:`to_element_cxx` applied to *cxx_type* and
+    every item in *xs*, and raises a LibsemigroupsError if any of these values
+    is ``None``, in the same way as the algorithms for elements with dynamic
+    degree.
+    """
+    result = [to_element_cxx(cxx_type, x) for x in xs]
+    for x, y in zip(xs, result, strict=True):
+        if y is None:
+            raise LibsemigroupsError(
+                f"expected an element of degree {_KIND_AND_PARAMS[cxx_type][1][1]}, "
+                f"found {x.degree()}"
+            )
+    return result
+
+
+def convert_element_args(
+    py_class: type, names: tuple[str, ...], result: Callable[[], Any] | None = None
+) -> None:
+    """Replaces each of the methods *names* of *py_class*, which must have an
+    element, or list of elements, as their only argument, by a method that
+    converts the elements to the C++ type of the elements of *self* using
+    :py:func:`to_element_cxx`, and then calls the original method. If any
+    element has an incompatible degree, then ``result()`` is returned instead,
+    or a LibsemigroupsError is raised if *result* is ``None``.
+    """
+    for name in names:
+        mem_fn = getattr(py_class, name)
+
+        def wrapper(self, arg, mem_fn=mem_fn):
+            cxx_type = self.py_template_params[0] if self.py_template_params else None
+            if result is None:
+                if isinstance(arg, list):
+                    return mem_fn(self, to_element_cxxs(cxx_type, arg))
+                return mem_fn(self, to_element_cxxs(cxx_type, [arg])[0])
+            xs = arg if isinstance(arg, list) else [arg]
+            ys = [to_element_cxx(cxx_type, x) for x in xs]
+            if any(y is None for y in ys):
+                return result()
+            return mem_fn(self, ys if isinstance(arg, list) else ys[0])
+
+        update_wrapper(wrapper, mem_fn)
+        setattr(py_class, name, wrapper)
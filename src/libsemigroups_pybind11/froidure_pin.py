@@ -12,13 +12,17 @@ manipulating :any:`FroidurePin` objects. All such functions
 are contained in the submodule ``libsemigroups_pybind11.froidure_pin``.
 """
 
+import struct as _struct
 from collections.abc import Iterator as _Iterator
+from functools import update_wrapper as _update_wrapper
 from typing import TypeVar as _TypeVar
 
+import numpy as _np
 from typing_extensions import Self as _Self
 
 from _libsemigroups_pybind11 import (
     LIBSEMIGROUPS_HPCOMBI_ENABLED as _LIBSEMIGROUPS_HPCOMBI_ENABLED,
+    UNDEFINED as _UNDEFINED,
     Bipartition as _Bipartition,
     BMat as _BMat,
     BMat8 as _BMat8,
@@ -80,8 +84,10 @@ from _libsemigroups_pybind11 import (
     Transf2 as _Transf2,
     Transf4 as _Transf4,
     froidure_pin_current_minimal_factorisation as _froidure_pin_current_minimal_factorisation,
+    froidure_pin_current_minimal_factorisation_many as _froidure_pin_current_minimal_factorisation_many,  # noqa: E501
     froidure_pin_current_normal_forms as _froidure_pin_current_normal_forms,
     froidure_pin_current_position as _froidure_pin_current_position,
+    froidure_pin_current_position_many as _froidure_pin_current_position_many,
     froidure_pin_current_rules as _froidure_pin_current_rules,
     froidure_pin_dot_current_left_cayley_graph as _froidure_pin_dot_current_left_cayley_graph,
     froidure_pin_dot_current_right_cayley_graph as _froidure_pin_dot_current_right_cayley_graph,
@@ -90,10 +96,14 @@ from _libsemigroups_pybind11 import (
     froidure_pin_equal_to as _froidure_pin_equal_to,
     froidure_pin_factorisation as _froidure_pin_factorisation,
     froidure_pin_minimal_factorisation as _froidure_pin_minimal_factorisation,
+    froidure_pin_minimal_factorisation_many as _froidure_pin_minimal_factorisation_many,
     froidure_pin_normal_forms as _froidure_pin_normal_forms,
+    froidure_pin_normal_forms_chunks as _froidure_pin_normal_forms_chunks,
     froidure_pin_position as _froidure_pin_position,
+    froidure_pin_position_many as _froidure_pin_position_many,
     froidure_pin_product_by_reduction as _froidure_pin_product_by_reduction,
     froidure_pin_rules as _froidure_pin_rules,
+    froidure_pin_rules_chunks as _froidure_pin_rules_chunks,
     froidure_pin_to_element as _froidure_pin_to_element,
 )
 
@@ -106,6 +116,11 @@ from .detail.cxx_wrapper import (
     wrap_cxx_free_fn as _wrap_cxx_free_fn,
 )
 from .detail.decorators import copydoc as _copydoc
+from .detail.static_ptransf import (
+    convert_element_args as _convert_element_args,
+    static_cxx_algorithm_types as _static_cxx_algorithm_types,
+    to_element_cxxs as _to_element_cxxs,
+)
 
 if _LIBSEMIGROUPS_HPCOMBI_ENABLED:
     # Disable pylint which complains if HPCOMBI is not enabled
@@ -132,44 +147,48 @@ class FroidurePin(_CxxWrapper):
 
     __doc__ = _FroidurePinPBR.__doc__
 
-    _py_template_params_to_cxx_type = {
-        (_BMat,): _FroidurePinBMat,
-        (_BMat8,): _FroidurePinBMat8,
-        (_Bipartition,): _FroidurePinBipartition,
-        (_IntMat,): _FroidurePinIntMat,
-        (_MaxPlusMat,): _FroidurePinMaxPlusMat,
-        (_MaxPlusTruncMat,): _FroidurePinMaxPlusTruncMat,
-        (_MinPlusMat,): _FroidurePinMinPlusMat,
-        (_MinPlusTruncMat,): _FroidurePinMinPlusTruncMat,
-        (_NTPMat,): _FroidurePinNTPMat,
-        (_PBR,): _FroidurePinPBR,
-        (_PPerm1,): _FroidurePinPPerm1,
-        (_PPerm2,): _FroidurePinPPerm2,
-        (_PPerm4,): _FroidurePinPPerm4,
-        (_Perm1,): _FroidurePinPerm1,
-        (_Perm2,): _FroidurePinPerm2,
-        (_Perm4,): _FroidurePinPerm4,
-        (_ProjMaxPlusMat,): _FroidurePinProjMaxPlusMat,
-        (_Transf1,): _FroidurePinTransf1,
-        (_Transf2,): _FroidurePinTransf2,
-        (_Transf4,): _FroidurePinTransf4,
-        (_KBEStringLenLexTrie,): _FroidurePinKBEStringLenLexTrie,
-        (_KBEStringLenLexSet,): _FroidurePinKBEStringLenLexSet,
-        (_KBEWordLenLexTrie,): _FroidurePinKBEWordLenLexTrie,
-        (_KBEWordLenLexSet,): _FroidurePinKBEWordLenLexSet,
-        (_KBEStringRevRPOTrie,): _FroidurePinKBEStringRevRPOTrie,
-        (_KBEStringRevRPOSet,): _FroidurePinKBEStringRevRPOSet,
-        (_KBEWordRevRPOTrie,): _FroidurePinKBEWordRevRPOTrie,
-        (_KBEWordRevRPOSet,): _FroidurePinKBEWordRevRPOSet,
-    } | (
+    _py_template_params_to_cxx_type = (
         {
-            (_HPCombiPTransf16,): _FroidurePinHPCombiPTransf16,
-            (_HPCombiTransf16,): _FroidurePinHPCombiTransf16,
-            (_HPCombiPerm16,): _FroidurePinHPCombiPerm16,
-            (_HPCombiPPerm16,): _FroidurePinHPCombiPPerm16,
+            (_BMat,): _FroidurePinBMat,
+            (_BMat8,): _FroidurePinBMat8,
+            (_Bipartition,): _FroidurePinBipartition,
+            (_IntMat,): _FroidurePinIntMat,
+            (_MaxPlusMat,): _FroidurePinMaxPlusMat,
+            (_MaxPlusTruncMat,): _FroidurePinMaxPlusTruncMat,
+            (_MinPlusMat,): _FroidurePinMinPlusMat,
+            (_MinPlusTruncMat,): _FroidurePinMinPlusTruncMat,
+            (_NTPMat,): _FroidurePinNTPMat,
+            (_PBR,): _FroidurePinPBR,
+            (_PPerm1,): _FroidurePinPPerm1,
+            (_PPerm2,): _FroidurePinPPerm2,
+            (_PPerm4,): _FroidurePinPPerm4,
+            (_Perm1,): _FroidurePinPerm1,
+            (_Perm2,): _FroidurePinPerm2,
+            (_Perm4,): _FroidurePinPerm4,
+            (_ProjMaxPlusMat,): _FroidurePinProjMaxPlusMat,
+            (_Transf1,): _FroidurePinTransf1,
+            (_Transf2,): _FroidurePinTransf2,
+            (_Transf4,): _FroidurePinTransf4,
+            (_KBEStringLenLexTrie,): _FroidurePinKBEStringLenLexTrie,
+            (_KBEStringLenLexSet,): _FroidurePinKBEStringLenLexSet,
+            (_KBEWordLenLexTrie,): _FroidurePinKBEWordLenLexTrie,
+            (_KBEWordLenLexSet,): _FroidurePinKBEWordLenLexSet,
+            (_KBEStringRevRPOTrie,): _FroidurePinKBEStringRevRPOTrie,
+            (_KBEStringRevRPOSet,): _FroidurePinKBEStringRevRPOSet,
+            (_KBEWordRevRPOTrie,): _FroidurePinKBEWordRevRPOTrie,
+            (_KBEWordRevRPOSet,): _FroidurePinKBEWordRevRPOSet,
         }
-        if _LIBSEMIGROUPS_HPCOMBI_ENABLED
-        else {}
+        | _static_cxx_algorithm_types("FroidurePin")
+        | (
+            {
+                (_HPCombiPTransf16,): _FroidurePinHPCombiPTransf16,
+                (_HPCombiTransf16,): _FroidurePinHPCombiTransf16,
+                (_HPCombiPerm16,): _FroidurePinHPCombiPerm16,
+                (_HPCombiPPerm16,): _FroidurePinHPCombiPPerm16,
+            }
+            if _LIBSEMIGROUPS_HPCOMBI_ENABLED
+            else {}
+        )
     )
 
     _cxx_type_to_py_template_params = dict(
@@ -217,7 +236,7 @@ class FroidurePin(_CxxWrapper):
             gens = args[0]
         else:
             gens = list(args)
-        gens = [_to_cxx(x) for x in gens]
+        gens = _to_element_cxxs(type(_to_cxx(gens[0])), gens)
         self.py_template_params = (type(gens[0]),)
         self.init_cxx_obj(gens)
 
@@ -256,8 +275,41 @@ class FroidurePin(_CxxWrapper):
         self._raise_if_element_not_implemented()
         return (_to_py(x) for x in _to_cxx(self).sorted_elements())
 
+    ########################################################################
+    # Snapshots
+    ########################################################################
+
+    @_copydoc(_FroidurePinTransf1.save_snapshot)
+    def save_snapshot(  # pylint: disable=missing-function-docstring
+        self: _Self, filename: str
+    ) -> None:
+        if not hasattr(_to_cxx(self), "save_snapshot"):
+            raise NotImplementedError(
+                "It is not possible to save snapshots of FroidurePin objects with "
+                "this type of element."
+            )
+        _to_cxx(self).save_snapshot(filename)
+
 
 _copy_cxx_mem_fns(_FroidurePinBMat, FroidurePin)
+_convert_element_args(
+    FroidurePin,
+    (
+        "add_generator",
+        "add_generators",
+        "closure",
+        "contains_many",
+        "copy_add_generators",
+        "copy_closure",
+        "current_position_many",
+        "position_many",
+        "sorted_position_many",
+    ),
+)
+_convert_element_args(FroidurePin, ("contains",), lambda: False)
+_convert_element_args(
+    FroidurePin, ("current_position", "position", "sorted_position"), lambda: _UNDEFINED
+)
 
 for _fp_type in (
     FroidurePin._py_template_params_to_cxx_type.values()  # pylint:disable=protected-access
@@ -277,28 +329,133 @@ _register_cxx_wrapped_type(_FroidurePinTCE, FroidurePin)
 # TODO(1) be good to get the notes about enumeration being triggered or not, in
 # this doc
 
+
+def _wrap_element_free_fn(cxx_free_fn):
+    # The same as _wrap_cxx_free_fn, except that the 2nd argument, if it is an
+    # element, is converted to the C++ type of the elements of the 1st.
+    wrapped = _wrap_cxx_free_fn(cxx_free_fn)
+
+    def element_free_fn_wrapper(fp, x):
+        cxx_type = fp.py_template_params[0] if fp.py_template_params else None
+        return wrapped(fp, _to_element_cxxs(cxx_type, [x])[0])
+
+    _update_wrapper(element_free_fn_wrapper, wrapped)
+    return element_free_fn_wrapper
+
+
 current_minimal_factorisation = _wrap_cxx_free_fn(_froidure_pin_current_minimal_factorisation)
+current_minimal_factorisation_many = _wrap_cxx_free_fn(
+    _froidure_pin_current_minimal_factorisation_many
+)
 current_normal_forms = _wrap_cxx_free_fn(_froidure_pin_current_normal_forms)
 current_position = _wrap_cxx_free_fn(_froidure_pin_current_position)
+current_position_many = _wrap_cxx_free_fn(_froidure_pin_current_position_many)
 current_rules = _wrap_cxx_free_fn(_froidure_pin_current_rules)
 dot_current_left_cayley_graph = _wrap_cxx_free_fn(_froidure_pin_dot_current_left_cayley_graph)
 dot_current_right_cayley_graph = _wrap_cxx_free_fn(_froidure_pin_dot_current_right_cayley_graph)
 dot_left_cayley_graph = _wrap_cxx_free_fn(_froidure_pin_dot_left_cayley_graph)
 dot_right_cayley_graph = _wrap_cxx_free_fn(_froidure_pin_dot_right_cayley_graph)
 equal_to = _wrap_cxx_free_fn(_froidure_pin_equal_to)
-factorisation = _wrap_cxx_free_fn(_froidure_pin_factorisation)
-minimal_factorisation = _wrap_cxx_free_fn(_froidure_pin_minimal_factorisation)
+factorisation = _wrap_element_free_fn(_froidure_pin_factorisation)
+minimal_factorisation = _wrap_element_free_fn(_froidure_pin_minimal_factorisation)
+minimal_factorisation_many = _wrap_cxx_free_fn(_froidure_pin_minimal_factorisation_many)
 normal_forms = _wrap_cxx_free_fn(_froidure_pin_normal_forms)
+normal_forms_chunks = _wrap_cxx_free_fn(_froidure_pin_normal_forms_chunks)
 position = _wrap_cxx_free_fn(_froidure_pin_position)
+position_many = _wrap_cxx_free_fn(_froidure_pin_position_many)
 product_by_reduction = _wrap_cxx_free_fn(_froidure_pin_product_by_reduction)
 rules = _wrap_cxx_free_fn(_froidure_pin_rules)
+rules_chunks = _wrap_cxx_free_fn(_froidure_pin_rules_chunks)
 to_element = _wrap_cxx_free_fn(_froidure_pin_to_element)
 
+########################################################################
+# Helpers -- snapshots
+########################################################################
+
+# The layout of the header of a snapshot file, see froidure-pin.cpp
+_SNAPSHOT_HEADER = _struct.Struct("=4sI32s5Q")
+_SNAPSHOT_MAGIC = b"LSFP"
+_SNAPSHOT_VERSION = 2
+
+
+def snapshot_arrays(filename: str) -> dict[str, _np.ndarray]:
+    """Memory map the data in a snapshot of a :any:`FroidurePin` instance.
+
+    This function returns a dictionary of read-only NumPy arrays that are
+    memory mapped from the file *filename*, which must have been written by
+    :any:`FroidurePin.save_snapshot`. The data in the file is not parsed or
+    copied, and so this function takes constant time, regardless of the size of
+    the snapshot. The keys and values of the returned dictionary are:
+
+    * ``"generators"`` and ``"elements"``: the generators and the so-far
+      enumerated elements, one per row. Transformations, partial perms, and
+      permutations are stored as their lists of images, and other types of
+      elements as their bytes;
+    * ``"right_cayley_graph"`` and ``"left_cayley_graph"``: the current right
+      and left Cayley graphs, one row per element and one column per generator;
+    * ``"prefix"``, ``"suffix"``, ``"first_letter"``, ``"final_letter"``, and
+      ``"length"``: the values of :any:`FroidurePin.prefix`,
+      :any:`FroidurePin.suffix`, :any:`FroidurePin.first_letter`,
+      :any:`FroidurePin.final_letter`, and :any:`FroidurePin.current_length`
+      for every so-far enumerated element;
+    * ``"sorted_position"``: the value of :any:`FroidurePin.to_sorted_position`
+      for every element; this is only present if the enumeration was finished
+      when the snapshot was saved.
+
+    Undefined values in the Cayley graphs, and the prefix and suffix arrays, are
+    represented by ``2 ** 32 - 1``.
+
+    :param filename: the name of the file.
+    :type filename: str
+
+    :returns: The arrays in the snapshot.
+    :rtype: dict[str, numpy.ndarray]
+
+    :raises ValueError: if *filename* is not a valid snapshot file.
+    """
+    with open(filename, "rb") as file:
+        header = file.read(_SNAPSHOT_HEADER.size)
+    if len(header) != _SNAPSHOT_HEADER.size or header[:4] != _SNAPSHOT_MAGIC:
+        raise ValueError(f"the file {filename} is not a valid LSFP file")
+    _, version, _, degree, point_bytes, nr_gens, size, finished = _SNAPSHOT_HEADER.unpack(header)
+    if version != _SNAPSHOT_VERSION:
+        raise ValueError(
+            f"the file {filename} has version {version}, but only version "
+            f"{_SNAPSHOT_VERSION} is supported"
+        )
+
+    point_dtype = _np.dtype(f"=u{point_bytes}")
+    offset = _SNAPSHOT_HEADER.size
+    result = {}
+
+    def add(key, dtype, shape):
+        nonlocal offset
+        if _np.prod(shape) == 0:
+            result[key] = _np.empty(shape, dtype=dtype)
+        else:
+            result[key] = _np.memmap(filename, dtype=dtype, mode="r", offset=offset, shape=shape)
+        nbytes = int(_np.prod(shape)) * dtype.itemsize
+        offset += nbytes + (-nbytes % 8)
+
+    uint32 = _np.dtype("=u4")
+    add("generators", point_dtype, (nr_gens, degree))
+    add("elements", point_dtype, (size, degree))
+    add("right_cayley_graph", uint32, (size, nr_gens))
+    add("left_cayley_graph", uint32, (size, nr_gens))
+    for key in ("prefix", "suffix", "first_letter", "final_letter", "length"):
+        add(key, uint32, (size,))
+    if finished:
+        add("sorted_position", uint32, (size,))
+    return result
+
+
 __all__ = [
     "FroidurePin",
     "current_minimal_factorisation",
+    "current_minimal_factorisation_many",
     "current_normal_forms",
     "current_position",
+    "current_position_many",
     "current_rules",
     "dot_current_left_cayley_graph",
     "dot_current_right_cayley_graph",
@@ -307,9 +464,14 @@ __all__ = [
     "equal_to",
     "factorisation",
     "minimal_factorisation",
+    "minimal_factorisation_many",
     "normal_forms",
+    "normal_forms_chunks",
     "position",
+    "position_many",
     "product_by_reduction",
     "rules",
+    "rules_chunks",
+    "snapshot_arrays",
     "to_element",
 ]
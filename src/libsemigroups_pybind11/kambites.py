@@ -16,7 +16,9 @@ from _libsemigroups_pybind11 import (
     KambitesWord as _KambitesWord,
     kambites_non_trivial_classes as _kambites_non_trivial_classes,
     kambites_normal_forms as _kambites_normal_forms,
+    kambites_normal_forms_chunks as _kambites_normal_forms_chunks,
     kambites_partition as _kambites_partition,
+    kambites_partition_ids as _kambites_partition_ids,
 )
 
 from .detail.congruence_common import CongruenceCommon as _CongruenceCommon
@@ -71,6 +73,15 @@ _register_cxx_wrapped_type(_KambitesString, Kambites)
 
 non_trivial_classes = _wrap_cxx_free_fn(_kambites_non_trivial_classes)
 normal_forms = _wrap_cxx_free_fn(_kambites_normal_forms)
+normal_forms_chunks = _wrap_cxx_free_fn(_kambites_normal_forms_chunks)
 partition = _wrap_cxx_free_fn(_kambites_partition)
+partition_ids = _wrap_cxx_free_fn(_kambites_partition_ids)
 
-__all__ = ["Kambites", "non_trivial_classes", "normal_forms", "partition"]
+__all__ = [
+    "Kambites",
+    "non_trivial_classes",
+    "normal_forms",
+    "normal_forms_chunks",
+    "partition",
+    "partition_ids",
+]
@@ -25,7 +25,9 @@ from _libsemigroups_pybind11 import (
     knuth_bendix_is_reduced as _knuth_bendix_is_reduced,
     knuth_bendix_non_trivial_classes as _knuth_bendix_non_trivial_classes,
     knuth_bendix_normal_forms as _knuth_bendix_normal_forms,
+    knuth_bendix_normal_forms_chunks as _knuth_bendix_normal_forms_chunks,
     knuth_bendix_partition as _knuth_bendix_partition,
+    knuth_bendix_partition_ids as _knuth_bendix_partition_ids,
     knuth_bendix_redundant_rule as _knuth_bendix_redundant_rule,
 )
 
@@ -136,7 +138,9 @@ by_overlap_length = _wrap_cxx_free_fn(_knuth_bendix_by_overlap_length)
 is_reduced = _wrap_cxx_free_fn(_knuth_bendix_is_reduced)
 non_trivial_classes = _wrap_cxx_free_fn(_knuth_bendix_non_trivial_classes)
 normal_forms = _wrap_cxx_free_fn(_knuth_bendix_normal_forms)
+normal_forms_chunks = _wrap_cxx_free_fn(_knuth_bendix_normal_forms_chunks)
 partition = _wrap_cxx_free_fn(_knuth_bendix_partition)
+partition_ids = _wrap_cxx_free_fn(_knuth_bendix_partition_ids)
 redundant_rule = _wrap_cxx_free_fn(_knuth_bendix_redundant_rule)
 
 __all__ = [
@@ -145,6 +149,8 @@ __all__ = [
     "is_reduced",
     "non_trivial_classes",
     "normal_forms",
+    "normal_forms_chunks",
     "partition",
+    "partition_ids",
     "redundant_rule",
 ]
@@ -52,6 +52,11 @@ from .detail.cxx_wrapper import (
     to_py as _to_py,
 )
 from .detail.decorators import copydoc as _copydoc
+from .detail.static_ptransf import (
+    convert_element_args as _convert_element_args,
+    static_cxx_algorithm_types as _static_cxx_algorithm_types,
+    to_element_cxxs as _to_element_cxxs,
+)
 
 if _LIBSEMIGROUPS_HPCOMBI_ENABLED:
     # Disable pylint which complains if HPCOMBI is not enabled
@@ -77,24 +82,28 @@ class Konieczny(_CxxWrapper):
     Element = _TypeVar("Element")
     __doc__ = _KoniecznyBMat.__doc__
 
-    _py_template_params_to_cxx_type = {
-        (_BMat,): _KoniecznyBMat,
-        (_BMat8,): _KoniecznyBMat8,
-        (_MaxPlusTruncMat,): _KoniecznyMaxPlusTruncMat,
-        (_PPerm1,): _KoniecznyPPerm1,
-        (_PPerm2,): _KoniecznyPPerm2,
-        (_PPerm4,): _KoniecznyPPerm4,
-        (_Transf1,): _KoniecznyTransf1,
-        (_Transf2,): _KoniecznyTransf2,
-        (_Transf4,): _KoniecznyTransf4,
-    } | (
+    _py_template_params_to_cxx_type = (
         {
-            (_HPCombiPPerm16,): _KoniecznyHPCombiPPerm16,
-            (_HPCombiPTransf16,): _KoniecznyHPCombiPTransf16,
-            (_HPCombiTransf16,): _KoniecznyHPCombiTransf16,
+            (_BMat,): _KoniecznyBMat,
+            (_BMat8,): _KoniecznyBMat8,
+            (_MaxPlusTruncMat,): _KoniecznyMaxPlusTruncMat,
+            (_PPerm1,): _KoniecznyPPerm1,
+            (_PPerm2,): _KoniecznyPPerm2,
+            (_PPerm4,): _KoniecznyPPerm4,
+            (_Transf1,): _KoniecznyTransf1,
+            (_Transf2,): _KoniecznyTransf2,
+            (_Transf4,): _KoniecznyTransf4,
         }
-        if _LIBSEMIGROUPS_HPCOMBI_ENABLED
-        else {}
+        | _static_cxx_algorithm_types("Konieczny", names=("Transf", "PPerm"))
+        | (
+            {
+                (_HPCombiPPerm16,): _KoniecznyHPCombiPPerm16,
+                (_HPCombiPTransf16,): _KoniecznyHPCombiPTransf16,
+                (_HPCombiTransf16,): _KoniecznyHPCombiTransf16,
+            }
+            if _LIBSEMIGROUPS_HPCOMBI_ENABLED
+            else {}
+        )
     )
 
     _cxx_type_to_py_template_params = dict(
@@ -128,13 +137,16 @@ class Konieczny(_CxxWrapper):
                 (_Transf2,): _KoniecznyTransf2DClass,
                 (_Transf4,): _KoniecznyTransf4DClass,
             }
-            | {
-                (_HPCombiPPerm16,): _KoniecznyHPCombiPPerm16DClass,
-                (_HPCombiPTransf16,): _KoniecznyHPCombiPTransf16DClass,
-                (_HPCombiTransf16,): _KoniecznyHPCombiTransf16DClass,
-            }
-            if _LIBSEMIGROUPS_HPCOMBI_ENABLED
-            else {}
+            | _static_cxx_algorithm_types("Konieczny", "DClass", ("Transf", "PPerm"))
+            | (
+                {
+                    (_HPCombiPPerm16,): _KoniecznyHPCombiPPerm16DClass,
+                    (_HPCombiPTransf16,): _KoniecznyHPCombiPTransf16DClass,
+                    (_HPCombiTransf16,): _KoniecznyHPCombiTransf16DClass,
+                }
+                if _LIBSEMIGROUPS_HPCOMBI_ENABLED
+                else {}
+            )
         )
 
         _cxx_type_to_py_template_params = dict(
@@ -148,7 +160,7 @@ class Konieczny(_CxxWrapper):
         _all_wrapped_cxx_types = {*_py_template_params_to_cxx_type.values()}
 
         def __contains__(self: _Self, x: Element) -> bool:
-            return _to_cxx(self).contains(_to_cxx(x))
+            return self.contains(x)
 
         @_copydoc(_KoniecznyBMat8DClass.__init__)
         def __init__(self: _Self, *args) -> None:
@@ -174,12 +186,12 @@ class Konieczny(_CxxWrapper):
             gens = args[0]
         else:
             gens = list(args)
-        gens = [_to_cxx(x) for x in gens]
+        gens = _to_element_cxxs(type(_to_cxx(gens[0])), gens)
         self.py_template_params = (type(gens[0]),)
         self.init_cxx_obj(gens)
 
     def __contains__(self: _Self, x: Element) -> bool:
-        return _to_cxx(self).contains(_to_cxx(x))
+        return self.contains(x)
 
     ########################################################################
     # Iterators
@@ -207,6 +219,9 @@ class Konieczny(_CxxWrapper):
 
 _copy_cxx_mem_fns(_KoniecznyBMat8, Konieczny)
 _copy_cxx_mem_fns(_KoniecznyBMat8DClass, Konieczny.DClass)
+_convert_element_args(Konieczny, ("add_generator", "add_generators", "D_class_of_element"))
+_convert_element_args(Konieczny, ("contains", "is_regular_element"), lambda: False)
+_convert_element_args(Konieczny.DClass, ("contains",), lambda: False)
 
 for _type in (
     Konieczny._py_template_params_to_cxx_type.values()  # pylint: disable=protected-access
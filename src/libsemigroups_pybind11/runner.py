@@ -0,0 +1,69 @@
+# Copyright (c) 2025 J. D. Mitchell
+#
+# Distributed under the terms of the GPL license version 3.
+#
+# The full license is in the file LICENSE, distributed with this software.
+
+# The module doc string is what appears at the top of the helper function
+# doc page, and so is omitted.
+
+"""This page contains the documentation for various helper functions for
+:any:`Runner` objects. All such functions are contained in the submodule
+``libsemigroups_pybind11.runner``.
+"""
+
+from _libsemigroups_pybind11 import (
+    MetricsStream as _MetricsStream,
+    RaceResult as _RaceResult,
+    StopCondition as _StopCondition,
+    runner_current_size_at_least as _runner_current_size_at_least,
+    runner_is_tracing as _runner_is_tracing,
+    runner_number_of_active_rules_at_least as _runner_number_of_active_rules_at_least,
+    runner_number_of_nodes_active_at_least as _runner_number_of_nodes_active_at_least,
+    runner_race as _runner_race,
+    runner_record_metrics as _runner_record_metrics,
+    runner_resident_set_size_at_least as _runner_resident_set_size_at_least,
+    runner_start_tracing as _runner_start_tracing,
+    runner_stop_tracing as _runner_stop_tracing,
+    runner_write_trace as _runner_write_trace,
+)
+
+from .detail.cxx_wrapper import to_cxx as _to_cxx, wrap_cxx_free_fn as _wrap_cxx_free_fn
+from .detail.decorators import copydoc as _copydoc
+
+MetricsStream = _MetricsStream
+RaceResult = _RaceResult
+StopCondition = _StopCondition
+
+current_size_at_least = _wrap_cxx_free_fn(_runner_current_size_at_least)
+is_tracing = _wrap_cxx_free_fn(_runner_is_tracing)
+number_of_active_rules_at_least = _wrap_cxx_free_fn(_runner_number_of_active_rules_at_least)
+number_of_nodes_active_at_least = _wrap_cxx_free_fn(_runner_number_of_nodes_active_at_least)
+record_metrics = _wrap_cxx_free_fn(_runner_record_metrics)
+resident_set_size_at_least = _wrap_cxx_free_fn(_runner_resident_set_size_at_least)
+start_tracing = _wrap_cxx_free_fn(_runner_start_tracing)
+stop_tracing = _wrap_cxx_free_fn(_runner_stop_tracing)
+write_trace = _wrap_cxx_free_fn(_runner_write_trace)
+
+
+@_copydoc(_runner_race)
+def race(runners: list, max_threads: int = 0) -> RaceResult:
+    # pylint: disable=missing-function-docstring
+    return _runner_race([_to_cxx(x) for x in runners], max_threads)
+
+
+__all__ = [
+    "MetricsStream",
+    "RaceResult",
+    "StopCondition",
+    "current_size_at_least",
+    "is_tracing",
+    "number_of_active_rules_at_least",
+    "number_of_nodes_active_at_least",
+    "race",
+    "record_metrics",
+    "resident_set_size_at_least",
+    "start_tracing",
+    "stop_tracing",
+    "write_trace",
+]
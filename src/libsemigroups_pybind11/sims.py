@@ -7,6 +7,13 @@
 
 """full API for the helper functions is given below."""
 
+import itertools as _itertools
+import json as _json
+import os as _os
+import struct as _struct
+from dataclasses import asdict as _asdict, dataclass as _dataclass, replace as _replace
+
+import numpy as _np
 from typing_extensions import Self as _Self
 
 from _libsemigroups_pybind11 import (
@@ -16,13 +23,21 @@ from _libsemigroups_pybind11 import (
     Sims2 as _Sims2,
     SimsRefinerFaithful as _SimsRefinerFaithful,
     SimsRefinerIdeals as _SimsRefinerIdeals,
+    WordGraph as _WordGraph,
+    sims_compatible_with as _compatible_with,
+    sims_faithful_on as _faithful_on,
     sims_is_maximal_right_congruence as _is_maximal_right_congruence,
     sims_is_right_congruence as _is_right_congruence,
     sims_is_right_congruence_of_dual as _is_right_congruence_of_dual,
     sims_is_two_sided_congruence as _is_two_sided_congruence,
+    sims_max_nodes as _max_nodes,
+    sims_not_identified as _not_identified,
     sims_poset as _poset,
+    sims_poset_sparse as _poset_sparse,
     sims_right_generating_pairs as _right_generating_pairs,
+    sims_strictly_cyclic as _strictly_cyclic,
     sims_two_sided_generating_pairs as _two_sided_generating_pairs,
+    sims_write_word_graphs as _write_word_graphs,
 )
 
 from .detail.cxx_wrapper import (
@@ -286,13 +301,574 @@ _register_cxx_wrapped_type(_SimsRefinerFaithful, SimsRefinerFaithful)
 # Helper functions
 ########################################################################
 
+compatible_with = _wrap_cxx_free_fn(_compatible_with)
+faithful_on = _wrap_cxx_free_fn(_faithful_on)
 is_maximal_right_congruence = _wrap_cxx_free_fn(_is_maximal_right_congruence)
 is_right_congruence = _wrap_cxx_free_fn(_is_right_congruence)
 is_right_congruence_of_dual = _wrap_cxx_free_fn(_is_right_congruence_of_dual)
 is_two_sided_congruence = _wrap_cxx_free_fn(_is_two_sided_congruence)
+max_nodes = _wrap_cxx_free_fn(_max_nodes)
+not_identified = _wrap_cxx_free_fn(_not_identified)
 poset = _wrap_cxx_free_fn(_poset)
+poset_sparse = _wrap_cxx_free_fn(_poset_sparse)
 right_generating_pairs = _wrap_cxx_free_fn(_right_generating_pairs)
+strictly_cyclic = _wrap_cxx_free_fn(_strictly_cyclic)
 two_sided_generating_pairs = _wrap_cxx_free_fn(_two_sided_generating_pairs)
+write_word_graphs = _wrap_cxx_free_fn(_write_word_graphs)
+
+########################################################################
+# Files of word graphs
+########################################################################
+
+_WORD_GRAPHS_MAGIC = b"LSWG"
+_WORD_GRAPHS_VERSION = 1
+# magic, version, out-degree, maximum number of nodes, bytes per target
+_WORD_GRAPHS_HEADER = _struct.Struct("=4sI3Q")
+
+
+class WordGraphReader:
+    """Read a file written by :any:`sims.write_word_graphs`.
+
+    Instances of this class provide random access to the word graphs in a file
+    written by :any:`sims.write_word_graphs`. The file is memory mapped, and so
+    only the parts of the file that are actually accessed are read, and
+    constructing a :any:`WordGraphReader` does not depend on the size of the
+    file. The word graphs in the file can be accessed either as
+    :any:`WordGraph` objects, using indexing or iteration, or as NumPy arrays,
+    using :any:`WordGraphReader.array`.
+
+    :param filename: the name of the file.
+    :type filename: str
+
+    :raises ValueError: if *filename* is not a valid file of word graphs.
+    """
+
+    def __init__(self: _Self, filename: str) -> None:
+        with open(filename, "rb") as file:
+            header = file.read(_WORD_GRAPHS_HEADER.size)
+        if len(header) != _WORD_GRAPHS_HEADER.size:
+            raise ValueError(f"the file {filename} is not a valid file of word graphs")
+        magic, version, out_degree, max_nodes, point_bytes = _WORD_GRAPHS_HEADER.unpack(header)
+        if magic != _WORD_GRAPHS_MAGIC:
+            raise ValueError(f"the file {filename} is not a valid file of word graphs")
+        if version != _WORD_GRAPHS_VERSION:
+            raise ValueError(
+                f"the file {filename} has version {version}, but only version "
+                f"{_WORD_GRAPHS_VERSION} is supported"
+            )
+        self._point = _np.dtype(f"=u{point_bytes}")
+        dtype = _np.dtype([("nodes", "=u4"), ("targets", self._point, (max_nodes, out_degree))])
+        size = _os.path.getsize(filename) - _WORD_GRAPHS_HEADER.size
+        if size % dtype.itemsize != 0:
+            raise ValueError(f"the file {filename} is truncated")
+        if size == 0:
+            # Empty files cannot be memory mapped
+            self._records = _np.empty(0, dtype=dtype)
+        else:
+            self._records = _np.memmap(
+                filename,
+                dtype=dtype,
+                mode="r",
+                offset=_WORD_GRAPHS_HEADER.size,
+                shape=(size // dtype.itemsize,),
+            )
+        self._out_degree = out_degree
+
+    def __len__(self: _Self) -> int:
+        return len(self._records)
+
+    def __getitem__(self: _Self, i: int) -> _WordGraph:
+        return _WordGraph(self.array(i))
+
+    def __iter__(self: _Self):
+        for i in range(len(self)):
+            yield self[i]
+
+    def __repr__(self: _Self) -> str:
+        return f"<WordGraphReader with {len(self)} word graphs of out-degree {self._out_degree}>"
+
+    def array(self: _Self, i: int) -> _np.ndarray:
+        """Returns the targets of a word graph in the file as a NumPy array.
+
+        This function returns the targets of the word graph in position *i* of
+        the file as a new NumPy array with the same shape, dtype, and
+        representation of undefined targets, as :any:`numpy.asarray` applied to
+        a :any:`WordGraph`.
+
+        :param i: the position of the word graph.
+        :type i: int
+
+        :returns: The targets of the word graph.
+        :rtype: numpy.ndarray
+
+        :raises IndexError: if *i* is out of range.
+        """
+        record = self._records[i]
+        result = record["targets"][: record["nodes"]].astype(_np.uint32)
+        if self._point.itemsize != 4:
+            result[record["targets"][: record["nodes"]] == _np.iinfo(self._point).max] = _np.iinfo(
+                _np.uint32
+            ).max
+        return result
+
+    def number_of_nodes(self: _Self) -> _np.ndarray:
+        """Returns the numbers of nodes of the word graphs in the file.
+
+        :returns: A read-only array whose entry in position ``i`` is the number
+            of nodes of the word graph in position ``i``.
+        :rtype: numpy.ndarray
+        """
+        return self._records["nodes"]
+
+    def out_degree(self: _Self) -> int:
+        """Returns the out-degree of the word graphs in the file.
+
+        :returns: The out-degree.
+        :rtype: int
+        """
+        return self._out_degree
+
+
+########################################################################
+# Distributed search
+########################################################################
+
+
+@_dataclass(frozen=True)
+class SimsWorkUnit:  # pylint: disable=too-many-instance-attributes
+    """A part of the search conducted by a :any:`Sims1` or :any:`Sims2` object.
+
+    Instances of this class are returned by :any:`sims.split`, and contain
+    everything required to run a part of a search in another process, or on
+    another machine, using :any:`sims.run_work_unit`. Instances of this class
+    only contain Python lists, integers, and strings, and so can be pickled,
+    or converted to and from JSON using :any:`SimsWorkUnit.to_json` and
+    :any:`SimsWorkUnit.from_json`.
+    """
+
+    #: One of ``"Sims1"``, ``"Sims2"``, or ``"RepOrc"``.
+    kind: str
+    #: The maximum number of classes in a congruence.
+    n: int
+    #: The alphabet of the presentation.
+    alphabet: list[int]
+    #: Whether or not the presentation contains the empty word.
+    contains_empty_word: bool
+    #: The rules of the presentation, including the long rules.
+    rules: list[list[int]]
+    #: The position of the first long rule in :py:attr:`rules`.
+    first_long_rule_position: int
+    #: The included pairs, ``(included_pairs[2*i], included_pairs[2*i+1])``.
+    included_pairs: list[list[int]]
+    #: The excluded pairs, ``(excluded_pairs[2*i], excluded_pairs[2*i+1])``.
+    excluded_pairs: list[list[int]]
+    #: The number of threads to use.
+    number_of_threads: int
+    #: The number of idle thread restarts.
+    idle_thread_restarts: int
+    #: The minimum number of nodes (only used if :py:attr:`kind` is ``"RepOrc"``).
+    min_nodes: int = 0
+    #: The maximum number of nodes (only used if :py:attr:`kind` is ``"RepOrc"``).
+    max_nodes: int = 0
+    #: The target size (only used if :py:attr:`kind` is ``"RepOrc"``).
+    target_size: int = 0
+
+    def sims(self: _Self) -> Sims1 | Sims2 | RepOrc:
+        """Construct the :any:`Sims1`, :any:`Sims2`, or :any:`RepOrc` object
+        for this unit.
+
+        :returns: The object whose search is described by this unit.
+        :rtype: Sims1 | Sims2 | RepOrc
+        """
+        p = _Presentation(self.alphabet)
+        p.contains_empty_word(self.contains_empty_word)
+        p.rules = self.rules
+        result = {"Sims1": Sims1, "Sims2": Sims2, "RepOrc": RepOrc}[self.kind](p)
+        if self.kind == "RepOrc":
+            result.min_nodes(self.min_nodes).max_nodes(self.max_nodes)
+            result.target_size(self.target_size)
+        result.first_long_rule_position(self.first_long_rule_position)
+        for i in range(0, len(self.included_pairs), 2):
+            result.add_included_pair(self.included_pairs[i], self.included_pairs[i + 1])
+        for i in range(0, len(self.excluded_pairs), 2):
+            result.add_excluded_pair(self.excluded_pairs[i], self.excluded_pairs[i + 1])
+        result.number_of_threads(self.number_of_threads)
+        result.idle_thread_restarts(self.idle_thread_restarts)
+        return result
+
+    def to_json(self: _Self) -> str:
+        """Convert to a JSON string.
+
+        :returns: A JSON string that can be converted back using
+            :any:`SimsWorkUnit.from_json`.
+        :rtype: str
+        """
+        return _json.dumps(_asdict(self))
+
+    @classmethod
+    def from_json(cls, s: str) -> "SimsWorkUnit":
+        """Construct from a JSON string returned by :any:`SimsWorkUnit.to_json`.
+
+        :param s: the JSON string.
+        :type s: str
+
+        :returns: The work unit.
+        :rtype: SimsWorkUnit
+        """
+        return cls(**_json.loads(s))
+
+
+def _split_pairs(alphabet: list[int], contains_empty_word: bool, depth: int) -> list:
+    # The first depth pairs of distinct words, in the order (w[0], w[1]),
+    # (w[0], w[2]), (w[1], w[2]), ..., where w is the list of all words in
+    # short-lex order.
+    words = [[]] if contains_empty_word else []
+    pairs = []
+    if depth == 0 or len(alphabet) == 0:
+        return pairs
+    for length in _itertools.count(1):
+        for w in _itertools.product(alphabet, repeat=length):
+            for u in words:
+                if len(pairs) == depth:
+                    return pairs
+                pairs.append((u, list(w)))
+            words.append(list(w))
+    return pairs  # pragma: no cover
+
+
+def split(s: Sims1 | Sims2, n: int, depth: int) -> list[SimsWorkUnit]:
+    r"""Split the search for congruences into independent work units.
+
+    This function splits the search for the congruences with at most *n*
+    classes conducted by *s* into :math:`2 ^ d` work units, where :math:`d` is
+    *depth*. The units are defined by the first *depth* pairs
+    :math:`(u_1, v_1), \ldots, (u_d, v_d)` of distinct words in short-lex
+    order, and there is one unit for every subset :math:`A` of
+    :math:`\{1, \ldots, d\}`. The unit for :math:`A` finds exactly the
+    congruences found by *s* that contain :math:`(u_i, v_i)` if and only if
+    :math:`i \in A`, using the included and excluded pairs of
+    :any:`Sims1` and :any:`Sims2`. In particular, every congruence found by
+    *s* is found by exactly one unit.
+
+    The units can be run independently, in any process or on any machine,
+    using :any:`sims.run_work_unit`, and the results can be combined using
+    :any:`sims.merge`. The units are not necessarily of similar sizes, and
+    some might not contain any congruences at all, and so it is usually
+    better to create many more units than there are processes available.
+
+    The units are not defined by partial word graphs, and each unit runs a
+    complete search, from the beginning, of the same search tree as *s*, in
+    which the included and excluded pairs of the unit are only used to prune
+    branches. As such, the work done by *s* is not divided between the
+    units, and the parts of the search tree that are visited before any of
+    these pairs can be decided are visited by every unit. Splitting a search
+    only reduces the time it takes if the included and excluded pairs prune
+    large parts of the search tree in every unit.
+
+    The pruners of *s* cannot be converted into work units, and so *s* must
+    not have any.
+
+    :param s: the object whose search should be split.
+    :type s: Sims1 | Sims2
+
+    :param n: the maximum number of classes in a congruence.
+    :type n: int
+
+    :param depth: the number of pairs used to split the search.
+    :type depth: int
+
+    :returns: The work units.
+    :rtype: list[SimsWorkUnit]
+
+    :raises ValueError: if *s* has any pruners.
+    :raises ValueError: if *depth* is negative.
+    """
+    return _units(s, depth, "Sims1" if isinstance(s, Sims1) else "Sims2", n=n)
+
+
+def _units(s, depth: int, kind: str, **kwargs) -> list[SimsWorkUnit]:
+    if len(s.pruners()) != 0:
+        raise ValueError(f"the 1st argument ({type(s).__name__}) must not have any pruners")
+    if depth < 0:
+        raise ValueError(f"the argument (depth) must be non-negative, found {depth}")
+    p = s.presentation()
+    # long_rules yields the words of the long rules, not pairs of words
+    long_rules = list(s.long_rules())
+    base = {
+        "kind": kind,
+        "alphabet": list(p.alphabet()),
+        "contains_empty_word": p.contains_empty_word(),
+        "rules": [list(w) for w in p.rules],
+        "first_long_rule_position": len(p.rules) - len(long_rules),
+        "number_of_threads": s.number_of_threads(),
+        "idle_thread_restarts": s.idle_thread_restarts(),
+        **kwargs,
+    }
+    base.setdefault("n", base.get("max_nodes", 0))
+    included = [list(w) for w in s.included_pairs()]
+    excluded = [list(w) for w in s.excluded_pairs()]
+    pairs = _split_pairs(base["alphabet"], base["contains_empty_word"], depth)
+    result = []
+    for subset in _itertools.product((True, False), repeat=depth):
+        inc, exc = list(included), list(excluded)
+        for (u, v), is_included in zip(pairs, subset, strict=True):
+            (inc if is_included else exc).extend((u, v))
+        result.append(SimsWorkUnit(included_pairs=inc, excluded_pairs=exc, **base))
+    return result
+
+
+def run_work_unit(unit: SimsWorkUnit, word_graphs: bool = False) -> int | list[_np.ndarray]:
+    """Run a work unit returned by :any:`sims.split`.
+
+    If *word_graphs* is ``False``, then this function returns the number of
+    congruences found by *unit* (if the :py:attr:`~SimsWorkUnit.kind` of
+    *unit* is ``"RepOrc"``, then this is ``1`` if :any:`RepOrc.word_graph`
+    finds a word graph, and ``0`` if not). Otherwise, it returns the word graphs of these
+    congruences as NumPy arrays, in the format of :any:`numpy.asarray` applied
+    to a :any:`WordGraph`, which, unlike :any:`WordGraph` objects, can be
+    pickled and sent to another process. In either case, the results of
+    several units can be combined using :any:`sims.merge`.
+
+    :param unit: the work unit.
+    :type unit: SimsWorkUnit
+
+    :param word_graphs: whether or not to return the word graphs found
+        (default: ``False``).
+    :type word_graphs: bool
+
+    :returns: The number of congruences found, or their word graphs.
+    :rtype: int | list[numpy.ndarray]
+    """
+    s = unit.sims()
+    if unit.kind == "RepOrc":
+        wg = s.word_graph()
+        found = [_np.array(wg)] if wg.number_of_nodes() != 0 else []
+        return found if word_graphs else len(found)
+    if not word_graphs:
+        return s.number_of_congruences(unit.n)
+    return [_np.array(wg) for wg in s.iterator(unit.n)]
+
+
+def merge(results: list, word_graphs: bool | None = None) -> int | list[_WordGraph]:
+    """Combine the results of several calls to :any:`sims.run_work_unit`.
+
+    If *word_graphs* is ``None``, then whether *results* contains numbers of
+    congruences or word graphs is determined from the values in *results*.
+    Since this is not possible when *results* is empty, *word_graphs* must
+    be specified in this case.
+
+    :param results: the values returned by :any:`sims.run_work_unit`.
+    :type results: list[int] | list[list[numpy.ndarray]]
+
+    :param word_graphs: the value of the argument *word_graphs* used in the
+        calls to :any:`sims.run_work_unit` (default: ``None``).
+    :type word_graphs: bool | None
+
+    :returns: The total number of congruences found, or all of the word graphs
+        found.
+    :rtype: int | list[WordGraph]
+
+    :raises ValueError: if *results* is empty and *word_graphs* is ``None``.
+    """
+    if word_graphs is None:
+        if len(results) == 0:
+            raise ValueError(
+                "the 2nd argument (word_graphs) must be specified when the 1st "
+                "argument (results) is empty"
+            )
+        word_graphs = not all(isinstance(x, int) for x in results)
+    if not word_graphs:
+        return sum(results)
+    return [_WordGraph(_np.ascontiguousarray(x, dtype=_np.uint32)) for y in results for x in y]
+
+
+########################################################################
+# Checkpoints
+########################################################################
+
+_CHECKPOINT_VERSION = 1
+
+
+def _write_checkpoint(filename: str, state: dict) -> None:
+    # Write to a temporary file first, so that the previous checkpoint is
+    # not lost if the process is killed while writing.
+    tmp = f"{filename}.tmp"
+    with open(tmp, "w", encoding="utf-8") as file:
+        _json.dump(state, file)
+    _os.replace(tmp, filename)
+
+
+def _read_checkpoint(filename: str, settings: dict) -> dict | None:
+    if not _os.path.exists(filename):
+        return None
+    with open(filename, encoding="utf-8") as file:
+        state = _json.load(file)
+    if state.get("version") != _CHECKPOINT_VERSION:
+        raise ValueError(
+            f"the checkpoint {filename} has version {state.get('version')}, but only "
+            f"version {_CHECKPOINT_VERSION} is supported"
+        )
+    if state["settings"] != settings:
+        raise ValueError(
+            f"the checkpoint {filename} was written by a search with different settings"
+        )
+    return state
+
+
+def _add_stats(state: dict, s) -> None:
+    stats = s.stats()
+    state["stats"]["count_now"] += stats.count_now()
+    state["stats"]["total_pending_now"] += stats.total_pending_now()
+    state["stats"]["max_pending"] = max(state["stats"]["max_pending"], stats.max_pending())
+
+
+def _to_word_graph(targets: list | None) -> _WordGraph:
+    if targets is None:
+        return _WordGraph()
+    return _WordGraph(_np.array(targets, dtype=_np.uint32))
+
+
+def run_with_checkpoints(
+    s: Sims1 | Sims2 | RepOrc | MinimalRepOrc, filename: str, n: int | None = None, depth: int = 6
+) -> int | _WordGraph:
+    """Run a search, periodically saving its progress to a file.
+
+    This function runs the search conducted by *s*, and saves its progress to
+    the file *filename*, so that if the process running the search is
+    interrupted or killed, then calling this function again, with the same
+    arguments, continues the search from the last checkpoint. If *s* is a:
+
+    * :any:`Sims1` or :any:`Sims2` object, then this function returns
+      ``s.number_of_congruences(n)``;
+    * :any:`RepOrc` or :any:`MinimalRepOrc` object, then this function returns
+      a word graph with the properties described in :any:`RepOrc.word_graph`
+      or :any:`MinimalRepOrc.word_graph`, respectively.
+
+    The search is split into work units, as in :any:`sims.split`, using
+    *depth* pairs of words, and each unit is run in turn using
+    :py:meth:`~Sims1.number_of_threads` threads. The checkpoint is written
+    after every unit, and contains: the position of the next unit (the
+    frontier of the search); the number of congruences found so far, or the
+    best word graph found so far; and the sums of the values of
+    :any:`SimsStats.count_now` and :any:`SimsStats.total_pending_now`, and the
+    maximum of the values of :any:`SimsStats.max_pending`, over all units run so
+    far. The checkpoint is a JSON file, and is replaced atomically, so that
+    it is never left partially written.
+
+    The search conducted by :any:`MinimalRepOrc` consists of several searches
+    with decreasing :py:meth:`~RepOrc.max_nodes`, each of which is split into
+    work units, and the checkpoint also contains the current value of
+    :py:meth:`~RepOrc.max_nodes`.
+
+    The state of the search within a unit, such as the stack of pending
+    definitions of each thread, cannot be obtained from ``libsemigroups``, and
+    so it is not saved. The "frontier" in the checkpoint is only the position
+    of the next unit, and a restarted search repeats the whole of the unit
+    that was running when the search was interrupted. For the same reason,
+    the units are run one after another, each using
+    :py:meth:`~Sims1.number_of_threads` threads, and so a search run using
+    this function is serialised across units, and might take longer than the
+    same search run without checkpoints. Larger values of *depth* give more,
+    and usually smaller, units, and so less work is lost when a search is
+    interrupted (see :any:`sims.split` for the cost of this).
+
+    The word graph returned when *s* is a :any:`RepOrc` object might differ
+    from that returned by :any:`RepOrc.word_graph`, but has the same
+    properties.
+
+    :param s: the object whose search should be run.
+    :type s: Sims1 | Sims2 | RepOrc | MinimalRepOrc
+
+    :param filename: the name of the checkpoint file.
+    :type filename: str
+
+    :param n:
+        the maximum number of classes in a congruence; required if *s* is a
+        :any:`Sims1` or :any:`Sims2` object, and ignored otherwise (default:
+        ``None``).
+    :type n: int | None
+
+    :param depth: the number of pairs used to split the search (default: ``6``).
+    :type depth: int
+
+    :returns: The number of congruences or a word graph.
+    :rtype: int | WordGraph
+
+    :raises TypeError: if *s* is not of one of the types listed above.
+    :raises ValueError: if *s* is a :any:`Sims1` or :any:`Sims2` object and
+        *n* is ``None``.
+    :raises ValueError: if *s* has any pruners.
+    :raises ValueError:
+        if *filename* exists but was written by a search with a different
+        object or arguments.
+    """
+    # pylint: disable=too-many-branches
+    kind = type(s).__name__
+    if kind in ("Sims1", "Sims2"):
+        if n is None:
+            raise ValueError(f"the 3rd argument (n) must be an int when the 1st is a {kind}")
+        kwargs = {"n": n}
+    elif kind == "RepOrc":
+        kwargs = {
+            "min_nodes": s.min_nodes(),
+            "max_nodes": s.max_nodes(),
+            "target_size": s.target_size(),
+        }
+    elif kind == "MinimalRepOrc":
+        kwargs = {"min_nodes": 1, "max_nodes": s.target_size(), "target_size": s.target_size()}
+    else:
+        raise TypeError(
+            "expected the 1st argument to be a Sims1, Sims2, RepOrc, or MinimalRepOrc, "
+            f"but found {type(s)}"
+        )
+
+    units = _units(s, depth, "RepOrc" if kind == "MinimalRepOrc" else kind, **kwargs)
+    settings = {"kind": kind, "depth": depth, "unit": _asdict(units[0])}
+    state = _read_checkpoint(filename, settings) or {
+        "version": _CHECKPOINT_VERSION,
+        "settings": settings,
+        "next": 0,
+        "count": 0,
+        "best": None,
+        "max_nodes": kwargs.get("max_nodes", 0),
+        "done": False,
+        "stats": {"count_now": 0, "total_pending_now": 0, "max_pending": 0},
+    }
+
+    while not state["done"]:
+        if state["max_nodes"] != kwargs.get("max_nodes", 0):
+            kwargs["max_nodes"] = kwargs["n"] = state["max_nodes"]
+            units = [_replace(u, max_nodes=state["max_nodes"], n=state["max_nodes"]) for u in units]
+        found = None
+        while state["next"] < len(units) and found is None:
+            unit_sims = units[state["next"]].sims()
+            if kind in ("Sims1", "Sims2"):
+                state["count"] += unit_sims.number_of_congruences(n)
+            else:
+                wg = unit_sims.word_graph()
+                if wg.number_of_nodes() != 0:
+                    found = wg
+            _add_stats(state, unit_sims)
+            state["next"] += 1
+            if found is None:
+                _write_checkpoint(filename, state)
+
+        if found is not None:
+            state["best"] = _np.asarray(found).tolist()
+        if found is not None and kind == "MinimalRepOrc":
+            # Look for a word graph with fewer classes
+            nodes = found.number_of_nodes() - (0 if units[0].contains_empty_word else 1)
+            state["max_nodes"] = nodes - 1
+            state["next"] = 0
+            state["done"] = nodes - 1 < 1
+        else:
+            state["done"] = True
+        _write_checkpoint(filename, state)
+
+    if kind in ("Sims1", "Sims2"):
+        return state["count"]
+    return _to_word_graph(state["best"])
+
 
 __all__ = [
     "MinimalRepOrc",
@@ -301,11 +877,24 @@ __all__ = [
     "Sims2",
     "SimsRefinerFaithful",
     "SimsRefinerIdeals",
+    "SimsWorkUnit",
+    "WordGraphReader",
+    "compatible_with",
+    "faithful_on",
     "is_maximal_right_congruence",
     "is_right_congruence_of_dual",
     "is_right_congruence",
     "is_two_sided_congruence",
+    "max_nodes",
+    "merge",
+    "not_identified",
     "poset",
+    "poset_sparse",
     "right_generating_pairs",
+    "run_with_checkpoints",
+    "run_work_unit",
+    "split",
+    "strictly_cyclic",
     "two_sided_generating_pairs",
+    "write_word_graphs",
 ]
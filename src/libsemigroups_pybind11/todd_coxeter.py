@@ -21,7 +21,9 @@ from _libsemigroups_pybind11 import (
     todd_coxeter_is_non_trivial as _todd_coxeter_is_non_trivial,
     todd_coxeter_non_trivial_classes as _todd_coxeter_non_trivial_classes,
     todd_coxeter_normal_forms as _todd_coxeter_normal_forms,
+    todd_coxeter_normal_forms_chunks as _todd_coxeter_normal_forms_chunks,
     todd_coxeter_partition as _todd_coxeter_partition,
+    todd_coxeter_partition_ids as _todd_coxeter_partition_ids,
     todd_coxeter_perform_lookbehind as _todd_coxeter_perform_lookbehind,
     todd_coxeter_redundant_rule as _todd_coxeter_redundant_rule,
 )
@@ -84,7 +86,9 @@ class_of = _wrap_cxx_free_fn(_todd_coxeter_class_of)
 is_non_trivial = _wrap_cxx_free_fn(_todd_coxeter_is_non_trivial)
 non_trivial_classes = _wrap_cxx_free_fn(_todd_coxeter_non_trivial_classes)
 normal_forms = _wrap_cxx_free_fn(_todd_coxeter_normal_forms)
+normal_forms_chunks = _wrap_cxx_free_fn(_todd_coxeter_normal_forms_chunks)
 partition = _wrap_cxx_free_fn(_todd_coxeter_partition)
+partition_ids = _wrap_cxx_free_fn(_todd_coxeter_partition_ids)
 perform_lookbehind = _wrap_cxx_free_fn(_todd_coxeter_perform_lookbehind)
 redundant_rule = _wrap_cxx_free_fn(_todd_coxeter_redundant_rule)
 
@@ -95,7 +99,9 @@ __all__ = [
     "is_non_trivial",
     "non_trivial_classes",
     "normal_forms",
+    "normal_forms_chunks",
     "partition",
+    "partition_ids",
     "perform_lookbehind",
     "redundant_rule",
 ]
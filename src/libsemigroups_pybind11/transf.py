@@ -10,10 +10,12 @@ classes.
 """
 
 import abc
+from typing import Any
 
 from typing_extensions import Self
 
 from _libsemigroups_pybind11 import (
+    STATIC_PTRANSF_DEGREES as _STATIC_PTRANSF_DEGREES,
     Perm1 as _Perm1,
     Perm2 as _Perm2,
     Perm4 as _Perm4,
@@ -41,6 +43,7 @@ from .detail.cxx_wrapper import (
     wrap_cxx_free_fn as _wrap_cxx_free_fn,
 )
 from .detail.decorators import copydoc as _copydoc
+from .detail.static_ptransf import static_cxx_types as _static_cxx_types
 
 ########################################################################
 # PTransfBase protected python class
@@ -63,7 +66,10 @@ class _PTransfBase(_CxxWrapper):
         return ""  # pragma: no cover
 
     @staticmethod
-    def _py_template_params_from_degree(n: int) -> tuple[int]:
+    def _py_template_params_from_degree(n: int) -> tuple[int, ...]:
+        # The degree is only included for the types with static degree
+        if n in _STATIC_PTRANSF_DEGREES:
+            return (2**8, n)
         if n < 2**8:
             return (2**8,)
         if n < 2**16:
@@ -76,7 +82,7 @@ class _PTransfBase(_CxxWrapper):
 
     def _cxx_type_change_required(self: Self, n: int) -> bool:
         assert n <= 2**32
-        return n > self.py_template_params[0]
+        return self._py_template_params_from_degree(n) != self.py_template_params
 
     def __getitem__(self: Self, i: int) -> int | _Undefined:
         return _to_cxx(self)[i]
@@ -90,6 +96,15 @@ class _PTransfBase(_CxxWrapper):
     def __init__(self: Self, arg) -> None:
         super().__init__(arg)
         if _to_cxx(self) is not None:
+            # C++ objects with dynamic degree (such as those returned by
+            # Action, or the elements of a FroidurePin returned by "to") are
+            # converted, so that the C++ type only depends on the degree. The
+            # algorithms convert their arguments back to their own element
+            # type, see detail/static_ptransf.py.
+            if self._cxx_type_change_required(self.degree()):
+                images = list(self.images())
+                self._set_py_template_params_from_degree(len(images))
+                self.init_cxx_obj(images)
             return
 
         images = arg
@@ -110,6 +125,14 @@ class _PTransfBase(_CxxWrapper):
         return _to_cxx(self) == _to_cxx(other)
 
     def __lt__(self: Self, other) -> bool:
+        if (
+            isinstance(other, type(self))
+            and type(_to_cxx(self)) is not type(_to_cxx(other))
+            and self.py_template_params[0] == other.py_template_params[0]
+        ):
+            # Objects of different degrees can have different C++ types, and
+            # so are compared as the lists of their images.
+            return list(_to_cxx(self)) < list(_to_cxx(other))
         return _to_cxx(self) < _to_cxx(other)
 
     def __le__(self: Self, other) -> bool:
@@ -156,6 +179,18 @@ class _PTransfBase(_CxxWrapper):
             _to_cxx(self).increase_degree_by(n)
         return self
 
+    def swap(self: Self, other: Self) -> None:  # pylint: disable=missing-function-docstring
+        if not isinstance(other, type(self)):
+            raise TypeError(
+                f"expected the argument to be a {type(self).__name__}, found {type(other).__name__}"
+            )
+        # The C++ objects are swapped, rather than their contents, since they
+        # can have different types.
+        other_cxx_obj, other_py_template_params = _to_cxx(other), other.py_template_params
+        other._cxx_obj = _to_cxx(self)  # pylint: disable=protected-access
+        other.py_template_params = self.py_template_params
+        self._cxx_obj, self.py_template_params = other_cxx_obj, other_py_template_params
+
 
 ########################################################################
 # Transf python class
@@ -165,7 +200,11 @@ class _PTransfBase(_CxxWrapper):
 class Transf(_PTransfBase):
     __doc__ = _Transf1.__doc__
 
-    _py_template_params_to_cxx_type = {(2**8,): _Transf1, (2**16,): _Transf2, (2**32,): _Transf4}
+    _py_template_params_to_cxx_type = {
+        (2**8,): _Transf1,
+        (2**16,): _Transf2,
+        (2**32,): _Transf4,
+    } | _static_cxx_types("Transf")
 
     _cxx_type_to_py_template_params = dict(
         zip(
@@ -175,7 +214,7 @@ class Transf(_PTransfBase):
         )
     )
 
-    _all_wrapped_cxx_types = {_Transf1, _Transf2, _Transf4}
+    _all_wrapped_cxx_types = {*_py_template_params_to_cxx_type.values()}
 
     # This method only exists to copy the doc. . .
     @_copydoc(_Transf1.__init__)
@@ -201,6 +240,11 @@ class Transf(_PTransfBase):
         _PTransfBase.increase_degree_by(self, n)
         return self
 
+    # This method only exists to copy the doc. . .
+    @_copydoc(_Transf1.swap)
+    def swap(self: Self, other: Self) -> None:
+        _PTransfBase.swap(self, other)
+
     @staticmethod
     @_copydoc(_Transf1.one)
     def one(n: int) -> Self:
@@ -211,9 +255,9 @@ class Transf(_PTransfBase):
 
 
 _copy_cxx_mem_fns(_Transf1, Transf)
-_register_cxx_wrapped_type(_Transf1, Transf)
-_register_cxx_wrapped_type(_Transf2, Transf)
-_register_cxx_wrapped_type(_Transf4, Transf)
+
+for _type in Transf._all_wrapped_cxx_types:  # pylint: disable=protected-access
+    _register_cxx_wrapped_type(_type, Transf)
 
 ########################################################################
 # PPerm python class
@@ -223,7 +267,11 @@ _register_cxx_wrapped_type(_Transf4, Transf)
 class PPerm(_PTransfBase):
     __doc__ = _PPerm1.__doc__
 
-    _py_template_params_to_cxx_type = {(2**8,): _PPerm1, (2**16,): _PPerm2, (2**32,): _PPerm4}
+    _py_template_params_to_cxx_type = {
+        (2**8,): _PPerm1,
+        (2**16,): _PPerm2,
+        (2**32,): _PPerm4,
+    } | _static_cxx_types("PPerm")
 
     _cxx_type_to_py_template_params = dict(
         zip(
@@ -233,7 +281,7 @@ class PPerm(_PTransfBase):
         )
     )
 
-    _all_wrapped_cxx_types = {_PPerm1, _PPerm2, _PPerm4}
+    _all_wrapped_cxx_types = {*_py_template_params_to_cxx_type.values()}
 
     @staticmethod
     def _cxx_type_from_degree(n: int):
@@ -273,6 +321,11 @@ class PPerm(_PTransfBase):
         _PTransfBase.increase_degree_by(self, n)
         return self
 
+    # This method only exists to copy the doc. . .
+    @_copydoc(_PPerm1.swap)
+    def swap(self: Self, other: Self) -> None:
+        _PTransfBase.swap(self, other)
+
     @staticmethod
     @_copydoc(_PPerm1.one)
     def one(n: int) -> Self:
@@ -284,9 +337,8 @@ class PPerm(_PTransfBase):
 
 _copy_cxx_mem_fns(_PPerm1, PPerm)
 
-_register_cxx_wrapped_type(_PPerm1, PPerm)
-_register_cxx_wrapped_type(_PPerm2, PPerm)
-_register_cxx_wrapped_type(_PPerm4, PPerm)
+for _type in PPerm._all_wrapped_cxx_types:  # pylint: disable=protected-access
+    _register_cxx_wrapped_type(_type, PPerm)
 
 
 ########################################################################
@@ -298,7 +350,11 @@ _register_cxx_wrapped_type(_PPerm4, PPerm)
 class Perm(_PTransfBase):
     __doc__ = _Perm1.__doc__
 
-    _py_template_params_to_cxx_type = {(2**8,): _Perm1, (2**16,): _Perm2, (2**32,): _Perm4}
+    _py_template_params_to_cxx_type = {
+        (2**8,): _Perm1,
+        (2**16,): _Perm2,
+        (2**32,): _Perm4,
+    } | _static_cxx_types("Perm")
 
     _cxx_type_to_py_template_params = dict(
         zip(
@@ -308,7 +364,7 @@ class Perm(_PTransfBase):
         )
     )
 
-    _all_wrapped_cxx_types = {_Perm1, _Perm2, _Perm4}
+    _all_wrapped_cxx_types = {*_py_template_params_to_cxx_type.values()}
 
     # This method only exists to copy the doc. . .
     @_copydoc(_Perm1.__init__)
@@ -334,6 +390,11 @@ class Perm(_PTransfBase):
         _PTransfBase.increase_degree_by(self, n)
         return self
 
+    # This method only exists to copy the doc. . .
+    @_copydoc(_Perm1.swap)
+    def swap(self: Self, other: Self) -> None:
+        _PTransfBase.swap(self, other)
+
     @staticmethod
     @_copydoc(_Perm1.one)
     def one(n: int) -> Self:
@@ -343,9 +404,33 @@ class Perm(_PTransfBase):
 
 _copy_cxx_mem_fns(_Perm1, Perm)
 
-_register_cxx_wrapped_type(_Perm1, Perm)
-_register_cxx_wrapped_type(_Perm2, Perm)
-_register_cxx_wrapped_type(_Perm4, Perm)
+for _type in Perm._all_wrapped_cxx_types:  # pylint: disable=protected-access
+    _register_cxx_wrapped_type(_type, Perm)
+
+########################################################################
+# Static degrees
+########################################################################
+
+# The C++ type with dynamic degree corresponding to every C++ type with static
+# degree.
+_STATIC_TO_DYNAMIC_CXX_TYPE = (
+    {cxx_type: _Transf1 for cxx_type in _static_cxx_types("Transf").values()}
+    | {cxx_type: _PPerm1 for cxx_type in _static_cxx_types("PPerm").values()}
+    | {cxx_type: _Perm1 for cxx_type in _static_cxx_types("Perm").values()}
+)
+
+
+def _to_dynamic_cxx(x: Any) -> Any:
+    """Returns the C++ object wrapped by *x*, converted to the corresponding type
+    with dynamic degree if it has static degree. This is for calling the C++
+    functions (such as those of Action) that are only defined for transformations,
+    partial perms, and permutations of dynamic degree.
+    """
+    x = _to_cxx(x)
+    if type(x) in _STATIC_TO_DYNAMIC_CXX_TYPE:
+        return _STATIC_TO_DYNAMIC_CXX_TYPE[type(x)](list(x.images()))
+    return x
+
 
 ########################################################################
 # Helper functions
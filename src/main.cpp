@@ -77,6 +77,10 @@ namespace libsemigroups {
     // Must be before runners
     init_reporter(m);
     init_runner(m);
+    init_trace(m);
+
+    // Must be before anything that returns chunks of packed words
+    init_packed_words(m);
 
     // Must be before cong classes
     init_present(m);
@@ -61,6 +61,7 @@ namespace libsemigroups {
   void init_matrix(py::module&);
   void init_obvinf(py::module&);
   void init_order(py::module&);
+  void init_packed_words(py::module&);
   void init_paths(py::module&);
   void init_pbr(py::module&);
   void init_present(py::module&);
@@ -78,6 +79,7 @@ namespace libsemigroups {
   void init_to_present(py::module&);
   void init_to_todd_coxeter(py::module&);
   void init_todd_coxeter(py::module&);
+  void init_trace(py::module&);
   void init_transf(py::module&);
   void init_types(py::module&);
   void init_ukkonen(py::module&);
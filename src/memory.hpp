@@ -0,0 +1,179 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_MEMORY_HPP_
+#define SRC_MEMORY_HPP_
+
+// C++ stl headers....
+#include <algorithm>    // for max
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <functional>   // for function
+#include <string_view>  // for string_view
+#include <type_traits>  // for is_trivially_copyable_v, is_same_v
+#include <vector>       // for vector
+
+// libsemigroups headers
+#include <libsemigroups/bipart.hpp>  // for Bipartition
+#include <libsemigroups/matrix.hpp>  // for IsMatrix
+#include <libsemigroups/pbr.hpp>     // for PBR
+#include <libsemigroups/transf.hpp>  // for IsPTransf
+
+#include <fmt/format.h>  // for format
+
+// pybind11....
+#include <pybind11/pybind11.h>
+
+// libsemigroups_pybind11....
+#include "runner.hpp"  // for run_releasing_gil
+#include "trace.hpp"   // for intern_trace_name
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  template <typename T>
+  struct IsStdVectorHelper : std::false_type {};
+
+  template <typename T, typename Alloc>
+  struct IsStdVectorHelper<std::vector<T, Alloc>> : std::true_type {};
+
+  // Returns an estimate of the number of bytes used by x, including any
+  // storage on the heap owned by x.
+  template <typename Element>
+  size_t element_memory_usage(Element const& x) {
+    if constexpr (std::is_trivially_copyable_v<Element>) {
+      return sizeof(Element);
+    } else if constexpr (IsStdVectorHelper<Element>::value) {
+      return sizeof(Element)
+             + x.capacity() * sizeof(typename Element::value_type);
+    } else if constexpr (IsPTransf<Element>) {
+      return sizeof(Element)
+             + x.degree() * sizeof(typename Element::point_type);
+    } else if constexpr (IsMatrix<Element>) {
+      return sizeof(Element)
+             + x.number_of_rows() * x.number_of_cols()
+                   * sizeof(typename Element::scalar_type);
+    } else if constexpr (std::is_same_v<Element, Bipartition>) {
+      return sizeof(Element) + 3 * x.degree() * sizeof(uint32_t);
+    } else if constexpr (std::is_same_v<Element, PBR>) {
+      return sizeof(Element) + 2 * x.degree() * sizeof(std::vector<uint32_t>);
+    } else {
+      return sizeof(Element);
+    }
+  }
+
+  // Define the member functions "memory_usage" and "run_with_memory_limit"
+  // for the Python class thing, where mem(x) returns an estimate of the number
+  // of bytes used by the main data structures of x. The parameter name is
+  // used in the doc.
+  template <typename Thing, typename... Options, typename MemFunc>
+  void def_memory_usage(py::class_<Thing, Options...>& thing,
+                        std::string_view                name,
+                        MemFunc                         mem) {
+    thing.def(
+        "memory_usage",
+        [mem](Thing& self) { return mem(self); },
+        fmt::format(R"pbdoc(
+:sig=(self: {0}) -> int:
+:only-document-once:
+
+Returns an estimate of the memory used.
+
+This function returns an estimate of the number of bytes held by the main data
+structures of a :any:`{0}` instance. The estimate is computed from the current
+sizes of these data structures, does not trigger any computation, and does not
+include the memory used by the Python object itself.
+
+:returns: The approximate number of bytes used.
+:rtype: int
+
+.. seealso:: :any:`run_with_memory_limit`.
+)pbdoc",
+                    name)
+            .c_str());
+
+    char const* trace_name
+        = intern_trace_name(fmt::format("{}.run_with_memory_limit", name));
+    thing.def(
+        "run_with_memory_limit",
+        [mem, trace_name](Thing& self, size_t limit) {
+          // The memory used is checked every time the algorithm checks if it
+          // should stop. Since data structures often grow geometrically, the
+          // next step of growth is taken to be twice the largest increase
+          // seen between two consecutive checks.
+          size_t                current = mem(self);
+          size_t                step    = 0;
+          bool                  hit     = current >= limit;
+          std::function<bool()> pred    = [&]() {
+            size_t const next = mem(self);
+            if (next > current) {
+              step = std::max(step, 2 * (next - current));
+            }
+            current = next;
+            hit     = current >= limit || step >= limit - current;
+            return hit;
+          };
+          if (hit) {
+            return !self.finished();
+          }
+          run_releasing_gil(self, trace_name, [&self, &pred]() {
+            self.run_until(pred);
+          });
+          return hit && !self.finished();
+        },
+        py::arg("limit"),
+        fmt::format(R"pbdoc(
+:sig=(self: {0}, limit: int) -> bool:
+:only-document-once:
+
+Run until finished or a memory limit is reached.
+
+This function runs a :any:`{0}` instance until it is finished, or until the
+next step of growth of its main data structures would take the value of
+:any:`memory_usage` to at least *limit*. The memory usage is checked every time
+the algorithm checks whether or not it should stop, and the size of the next
+step is estimated as twice the largest increase in :any:`memory_usage` between
+two such checks. Since this is only an estimate, *limit* should be chosen with
+some headroom below the memory actually available.
+
+There is no separate state of a :any:`Runner` for stopping because of the
+memory limit. If this function stops because the memory limit would have been
+reached, then :any:`Runner.current_state` is
+:any:`Runner.state.stopped_by_predicate`, and
+the computation can be resumed later, for example by calling this function
+again with a larger *limit*.
+
+This function releases the GIL, and handles interrupts, in the same way as
+:any:`Runner.run`.
+
+:param limit: the memory limit in bytes.
+:type limit: int
+
+:returns:
+  ``True`` if the computation was stopped because of the memory limit before
+  it finished, and ``False`` otherwise.
+:rtype: bool
+
+.. seealso:: :any:`memory_usage`.
+)pbdoc",
+                    name)
+            .c_str());
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_MEMORY_HPP_
@@ -0,0 +1,135 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_METRICS_HPP_
+#define SRC_METRICS_HPP_
+
+// C++ stl headers....
+#include <atomic>      // for atomic, memory_order
+#include <chrono>      // for steady_clock, system_clock, nanoseconds
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t
+#include <functional>  // for hash
+#include <thread>      // for this_thread
+
+// libsemigroups_pybind11....
+#include "bounded-queue.hpp"  // for BoundedQueue
+#include "runner.hpp"         // for StopCondition
+
+namespace libsemigroups {
+
+  // A single sample of the progress of a Runner.
+  struct MetricsSample {
+    // Seconds since the epoch.
+    double timestamp;
+    // The value of the counter, e.g. the number of nodes or rules so far.
+    uint64_t count;
+    // The number of units of count per second since the previous sample.
+    double rate;
+    // The name of the counter, e.g. "nodes"; always a string literal.
+    char const* name;
+    // An integer identifying the thread where the sample was recorded.
+    uint64_t thread_id;
+  };
+
+  // A bounded queue of MetricsSample objects. Pushing and popping never lock
+  // or allocate; if the queue is full, then pushed samples are discarded and
+  // counted.
+  class MetricsStream {
+   public:
+    MetricsStream(size_t capacity, std::chrono::nanoseconds interval)
+        : _queue(capacity), _interval(interval), _dropped(0) {}
+
+    MetricsStream(MetricsStream const&)            = delete;
+    MetricsStream& operator=(MetricsStream const&) = delete;
+
+    [[nodiscard]] size_t capacity() const noexcept {
+      return _queue.capacity();
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds interval() const noexcept {
+      return _interval;
+    }
+
+    [[nodiscard]] size_t dropped() const noexcept {
+      return _dropped.load(std::memory_order_relaxed);
+    }
+
+    bool push(MetricsSample sample) noexcept {
+      if (!_queue.try_push(sample)) {
+        _dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      return true;
+    }
+
+    bool pop(MetricsSample& sample) noexcept {
+      return _queue.try_pop(sample);
+    }
+
+   private:
+    BoundedQueue<MetricsSample> _queue;
+    std::chrono::nanoseconds    _interval;
+    std::atomic<size_t>         _dropped;
+  };
+
+  // Returns a StopCondition that is never satisfied, but that pushes a sample
+  // of count(thing) to stream at most once every stream.interval(). The
+  // condition is checked from the thread running thing, and so reading
+  // count(thing) is safe, and when no sample is due it costs a single call to
+  // steady_clock::now().
+  template <typename Thing, typename Count>
+  StopCondition record_metrics(Thing const&   thing,
+                               MetricsStream& stream,
+                               char const*    name,
+                               Count          count) {
+    using std::chrono::steady_clock;
+    auto start      = steady_clock::now();
+    auto last_time  = start;
+    auto next_time  = start;
+    auto last_count = static_cast<uint64_t>(count(thing));
+    return StopCondition([&thing, &stream, name, count, last_time, next_time,
+                          last_count]() mutable {
+      auto now = steady_clock::now();
+      if (now < next_time) {
+        return false;
+      }
+      auto   value   = static_cast<uint64_t>(count(thing));
+      double elapsed = std::chrono::duration<double>(now - last_time).count();
+      double rate    = elapsed > 0
+                           ? (static_cast<double>(value)
+                              - static_cast<double>(last_count))
+                                 / elapsed
+                           : 0.0;
+      auto   epoch   = std::chrono::system_clock::now().time_since_epoch();
+      stream.push(MetricsSample{
+          std::chrono::duration<double>(epoch).count(),
+          value,
+          rate,
+          name,
+          static_cast<uint64_t>(
+              std::hash<std::thread::id>()(std::this_thread::get_id()))});
+      last_time  = now;
+      last_count = value;
+      next_time  = now + stream.interval();
+      return false;
+    });
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_METRICS_HPP_
@@ -0,0 +1,55 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// C++ stl headers....
+#include <utility>  // for move
+
+// pybind11....
+#include <pybind11/pybind11.h>
+
+// libsemigroups_pybind11....
+#include "main.hpp"          // for init_packed_words
+#include "packed-words.hpp"  // for PackedWordsIterator
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  void init_packed_words(py::module& m) {
+    py::class_<PackedWordsIterator> thing(m,
+                                          "PackedWordsIterator",
+                                          R"pbdoc(
+An iterator yielding chunks of words packed into NumPy arrays.
+
+Instances of this class are returned by functions such as
+:any:`froidure_pin.normal_forms_chunks` and
+:any:`todd_coxeter.normal_forms_chunks`, and yield tuples ``(letters,
+offsets)`` of NumPy arrays, where the *i*-th word in the chunk is
+``letters[offsets[i]:offsets[i + 1]]``. Advancing the iterator releases the
+GIL while the words in the next chunk are computed.
+)pbdoc");
+
+    thing.def("__iter__", [](py::object self) { return self; });
+    thing.def("__next__", [](PackedWordsIterator& self) {
+      auto result = self.next();
+      if (!result) {
+        throw py::stop_iteration();
+      }
+      return std::move(*result);
+    });
+  }
+}  // namespace libsemigroups
@@ -0,0 +1,177 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_PACKED_WORDS_HPP_
+#define SRC_PACKED_WORDS_HPP_
+
+// C++ stl headers....
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint8_t, uint64_t
+#include <functional>   // for function
+#include <optional>     // for optional
+#include <string>       // for string
+#include <type_traits>  // for conditional_t, is_same_v
+#include <utility>      // for move
+#include <vector>       // for vector
+
+// libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+#include <libsemigroups/types.hpp>      // for letter_type
+
+// pybind11....
+#include <pybind11/numpy.h>     // for array_t
+#include <pybind11/pybind11.h>  // for tuple, gil_scoped_release
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  // Words can be passed to and from Python packed into two arrays, so that
+  // the i-th word is letters[offsets[i]:offsets[i + 1]].
+  template <typename Word>
+  using packed_letter_type = std::
+      conditional_t<std::is_same_v<Word, std::string>, uint8_t, letter_type>;
+
+  template <typename Word>
+  using letters_array = py::array_t<packed_letter_type<Word>,
+                                    py::array::c_style | py::array::forcecast>;
+
+  using offsets_array
+      = py::array_t<uint64_t, py::array::c_style | py::array::forcecast>;
+
+  template <typename Word>
+  std::vector<Word> unpack_words(letters_array<Word> const& letters,
+                                 offsets_array const&       offsets) {
+    if (letters.ndim() != 1 || offsets.ndim() != 1) {
+      LIBSEMIGROUPS_EXCEPTION(
+          "expected 1-dimensional arrays, found {} and {} dimensions",
+          letters.ndim(),
+          offsets.ndim());
+    } else if (offsets.size() == 0) {
+      LIBSEMIGROUPS_EXCEPTION("expected a non-empty array of offsets");
+    }
+    auto const* data = letters.data();
+    auto const* off  = offsets.data();
+    size_t      n    = offsets.size() - 1;
+    for (size_t i = 0; i < n; ++i) {
+      if (off[i] > off[i + 1]) {
+        LIBSEMIGROUPS_EXCEPTION("expected non-decreasing offsets, found {} "
+                                "in position {} and {} in position {}",
+                                off[i],
+                                i,
+                                off[i + 1],
+                                i + 1);
+      }
+    }
+    if (off[n] > static_cast<uint64_t>(letters.size())) {
+      LIBSEMIGROUPS_EXCEPTION("the last offset {} is greater than the number "
+                              "of letters {}",
+                              off[n],
+                              letters.size());
+    }
+    std::vector<Word> result;
+    result.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      result.emplace_back(data + off[i], data + off[i + 1]);
+    }
+    return result;
+  }
+
+  // Appends the letters of w to letters, and the new end of letters to
+  // offsets.
+  template <typename Letter, typename Word>
+  void append_packed_word(Word const&            w,
+                          std::vector<Letter>&   letters,
+                          std::vector<uint64_t>& offsets) {
+    letters.insert(letters.end(), w.begin(), w.end());
+    offsets.push_back(letters.size());
+  }
+
+  template <typename Letter>
+  py::tuple make_packed_words(std::vector<Letter> const&   letters,
+                              std::vector<uint64_t> const& offsets) {
+    return py::make_tuple(py::array_t<Letter>(letters.size(), letters.data()),
+                          py::array_t<uint64_t>(offsets.size(), offsets.data()));
+  }
+
+  template <typename Word>
+  py::tuple pack_words(std::vector<Word> const& words) {
+    std::vector<packed_letter_type<Word>> letters;
+    std::vector<uint64_t>                 offsets = {0};
+    for (auto const& w : words) {
+      append_packed_word(w, letters, offsets);
+    }
+    return make_packed_words(letters, offsets);
+  }
+
+  // A Python iterator whose values are the chunks of a (possibly infinite)
+  // sequence of words, each chunk packed as above. The next chunk is returned
+  // by the function next_chunk, or std::nullopt if there are no more chunks.
+  class PackedWordsIterator {
+   public:
+    using function_type = std::function<std::optional<py::tuple>()>;
+
+    explicit PackedWordsIterator(function_type next_chunk)
+        : _next_chunk(std::move(next_chunk)) {}
+
+    std::optional<py::tuple> next() {
+      return _next_chunk();
+    }
+
+   private:
+    function_type _next_chunk;
+  };
+
+  // Returns a PackedWordsIterator whose chunks contain the words appended by
+  // at most batch_size calls to append_next(letters, offsets), which should
+  // append the words of the next item (such as a normal form, or both sides of
+  // a rule) using append_packed_word, and return false if there are no more
+  // items. The words of every chunk are computed with the GIL released, and
+  // so append_next must not use any Python objects.
+  template <typename Letter, typename Func>
+  PackedWordsIterator make_packed_words_iterator(size_t batch_size,
+                                                 Func&& append_next) {
+    if (batch_size == 0) {
+      LIBSEMIGROUPS_EXCEPTION("the batch size must be positive, found 0");
+    }
+    return PackedWordsIterator(
+        [batch_size,
+         append_next = std::forward<Func>(append_next),
+         done        = false]() mutable -> std::optional<py::tuple> {
+          if (done) {
+            return std::nullopt;
+          }
+          std::vector<Letter>   letters;
+          std::vector<uint64_t> offsets = {0};
+          {
+            py::gil_scoped_release release;
+            for (size_t i = 0; i < batch_size; ++i) {
+              if (!append_next(letters, offsets)) {
+                done = true;
+                break;
+              }
+            }
+          }
+          if (offsets.size() == 1) {
+            return std::nullopt;
+          }
+          return make_packed_words(letters, offsets);
+        });
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_PACKED_WORDS_HPP_
@@ -17,9 +17,28 @@
 //
 
 // C++ headers
-#include <type_traits>  // for std::is_same_v
+#include <algorithm>           // for min, max
+#include <atomic>              // for atomic
+#include <chrono>              // for steady_clock
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <exception>           // for exception_ptr, current_exception
+#include <mutex>               // for mutex, lock_guard, unique_lock
+#include <thread>              // for thread
+#include <type_traits>         // for std::is_same_v
+#include <unordered_set>       // for unordered_set
+#include <vector>              // for vector
+
+#if defined(__linux__)
+#include <unistd.h>  // for sysconf
+
+#include <fstream>  // for ifstream
+#elif defined(__APPLE__)
+#include <mach/mach.h>  // for task_info
+#endif
 
 // libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/runner.hpp>
 
 // pybind11....
@@ -30,7 +49,9 @@
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_reporter, init_runner
+#include "main.hpp"     // for init_reporter, init_runner
+#include "metrics.hpp"  // for MetricsStream, MetricsSample
+#include "runner.hpp"   // for run_releasing_gil
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -73,8 +94,194 @@ namespace libsemigroups {
     to_system(high_resolution_clock::time_point const& tp) {
       return to_system_impl(tp);
     }
+
+    // Set in init_runner
+    unsigned long python_main_thread_ident = 0;
+
+    // The Runners currently being run by run_async or run_for_async, these
+    // are killed, and waited for, when the interpreter exits.
+    std::mutex                  async_runners_mtx;
+    std::condition_variable     async_runners_cv;
+    std::unordered_set<Runner*> async_runners;
+
+    // Resolve the concurrent.futures.Future future, either with the result
+    // None, or with the exception err. Must be called with the GIL held.
+    void resolve_future(py::object& future, std::exception_ptr err) {
+      try {
+        if (future.attr("cancelled")().cast<bool>()) {
+          return;
+        } else if (!err) {
+          future.attr("set_result")(py::none());
+          return;
+        }
+        try {
+          // Calling a cpp_function translates the C++ exception into the
+          // corresponding Python exception using the registered translators.
+          py::cpp_function([err]() { std::rethrow_exception(err); })();
+        } catch (py::error_already_set& e) {
+          future.attr("set_exception")(e.value());
+        }
+      } catch (py::error_already_set&) {
+        // The future was cancelled after we checked, and so can no longer
+        // be resolved, there's nothing to be done.
+      }
+    }
+
+    // Call func(r) in a new native thread, where r is the Runner wrapped by
+    // self, and return a concurrent.futures.Future that is resolved when func
+    // returns. Cancelling the future kills r. Must be called with the GIL
+    // held.
+    template <typename Func>
+    py::object run_async(py::object self, Func&& func) {
+      Runner& r = self.cast<Runner&>();
+      {
+        std::lock_guard<std::mutex> lock(async_runners_mtx);
+        if (r.running() || async_runners.count(&r) != 0) {
+          LIBSEMIGROUPS_EXCEPTION("the Runner is already running");
+        }
+        async_runners.insert(&r);
+      }
+
+      py::object future
+          = py::module_::import("concurrent.futures").attr("Future")();
+      future.attr("add_done_callback")(
+          py::cpp_function([&r](py::object const& fut) {
+            if (fut.attr("cancelled")().cast<bool>()) {
+              r.kill();
+            }
+          }));
+
+      // The thread holds a reference to self so that r is not destroyed
+      // before the thread is finished with it.
+      auto work = [self, future, &r, f = std::forward<Func>(func)]() mutable {
+        std::exception_ptr err;
+        try {
+          f(r);
+        } catch (...) {
+          err = std::current_exception();
+        }
+        {
+          py::gil_scoped_acquire acquire;
+          resolve_future(future, err);
+          // Release our references while we hold the GIL
+          future = py::object();
+          self   = py::object();
+        }
+        {
+          std::lock_guard<std::mutex> lock(async_runners_mtx);
+          async_runners.erase(&r);
+        }
+        async_runners_cv.notify_all();
+      };
+      std::thread(std::move(work)).detach();
+      return future;
+    }
+
+    // The return type of runner_race.
+    struct RaceResult {
+      size_t                                winner = UNDEFINED;
+      std::vector<std::chrono::nanoseconds> run_times;
+    };
+
+    // Run the Runners in runners in at most max_threads threads, until one of
+    // them finishes, and then kill all of the others.
+    RaceResult race(std::vector<Runner*> const& runners, size_t max_threads) {
+      using std::chrono::steady_clock;
+      size_t const no_winner = UNDEFINED;
+
+      RaceResult result;
+      result.run_times.assign(runners.size(), std::chrono::nanoseconds(0));
+      if (runners.empty()) {
+        return result;
+      }
+      if (max_threads == 0) {
+        max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+      }
+
+      std::atomic<size_t> next(0);
+      std::atomic<size_t> winner(no_winner);
+      std::mutex          error_mtx;
+      std::exception_ptr  error;
+
+      auto work = [&]() {
+        size_t i;
+        while ((i = next++) < runners.size() && winner == no_winner) {
+          auto       start = steady_clock::now();
+          TraceScope trace("Runner.run");
+          try {
+            runners[i]->run();
+          } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mtx);
+            if (!error) {
+              error = std::current_exception();
+            }
+          }
+          result.run_times[i] = steady_clock::now() - start;
+          size_t expected     = no_winner;
+          if (runners[i]->finished()
+              && winner.compare_exchange_strong(expected, i)) {
+            for (size_t j = 0; j < runners.size(); ++j) {
+              if (j != i) {
+                runners[j]->kill();
+              }
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (size_t t = 1; t < std::min(max_threads, runners.size()); ++t) {
+        threads.emplace_back(work);
+      }
+      work();
+      for (auto& t : threads) {
+        t.join();
+      }
+      result.winner = winner;
+      if (result.winner == no_winner && error) {
+        std::rethrow_exception(error);
+      }
+      return result;
+    }
+
+    void kill_async_runners() {
+      py::gil_scoped_release       release;
+      std::unique_lock<std::mutex> lock(async_runners_mtx);
+      for (auto* r : async_runners) {
+        r->kill();
+      }
+      async_runners_cv.wait(lock, []() { return async_runners.empty(); });
+    }
   }  // namespace
 
+  size_t resident_set_size() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    size_t        total = 0, resident = 0;
+    if (statm >> total >> resident) {
+      return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t      count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(),
+                  MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info),
+                  &count)
+        == KERN_SUCCESS) {
+      return info.resident_size;
+    }
+    return 0;
+#else
+    return 0;
+#endif
+  }
+
+  bool is_python_main_thread() {
+    return PyThread_get_thread_ident() == python_main_thread_ident;
+  }
+
   void init_reporter(py::module& m) {
     m.def(
         "delta",
@@ -358,6 +565,13 @@ run at the outermost level.
   }  // init_reporter
 
   void init_runner(py::module& m) {
+    python_main_thread_ident = py::module_::import("threading")
+                                   .attr("main_thread")()
+                                   .attr("ident")
+                                   .cast<unsigned long>();
+    py::module_::import("atexit").attr("register")(
+        py::cpp_function(&kill_async_runners));
+
     py::class_<Runner, Reporter> thing(m,
                                        "Runner",
                                        R"pbdoc(
@@ -475,18 +689,28 @@ been newly default constructed.
 .. seealso::  :any:`Runner()`
 )pbdoc",
         py::return_value_policy::reference_internal);
-    thing.def("run",
-              &Runner::run,
-              R"pbdoc(
+    thing.def(
+        "run",
+        [](Runner& self) {
+          run_releasing_gil(self, "Runner.run", [&self]() { self.run(); });
+        },
+        R"pbdoc(
 Run until finished.
 
 This function runs the main algorithm implemented by a derived class of
 :any:`Runner`.
+
+The GIL is released while this function runs, so that other Python threads
+can continue in the meantime. If this function is interrupted (for example,
+by pressing Ctrl-C), then :any:`kill` is called, and the resulting
+:any:`KeyboardInterrupt` is raised once the :any:`Runner` has stopped. The
+:any:`Runner` is then :any:`dead`.
 )pbdoc");
     thing.def(
         "run_for",
         [](Runner& self, std::chrono::nanoseconds t) {
-          return self.run_for(t);
+          run_releasing_gil(
+              self, "Runner.run_for", [&self, t]() { self.run_for(t); });
         },
         py::arg("t"),
         R"pbdoc(
@@ -496,17 +720,114 @@ For this to work it is necessary to periodically check if :any:`timed_out()`
 returns ``True``, and to stop if it does, in the :any:`run()` member function of
 any derived class of :any:`Runner`.
 
+The GIL is released, and interrupts are handled, as described in :any:`run`.
+
 :param t: the time to run for.
 :type t: datetime.timedelta
 
 .. seealso::  :any:`run_for`.
 )pbdoc");
-    thing.def("run_until",
-              (void(Runner::*)(std::function<bool()>&)) & Runner::run_until,
-              py::arg("func"),
-              R"pbdoc(
+    thing.def(
+        "run_async",
+        [](py::object self) {
+          return run_async(self, [](Runner& r) { r.run(); });
+        },
+        R"pbdoc(
+:sig=(self: Runner) -> concurrent.futures.Future:
+
+Run until finished, asynchronously.
+
+This function calls :any:`run` in a new native thread, without holding the
+GIL, and returns immediately. The returned :any:`concurrent.futures.Future` is
+resolved, with the result ``None``, once :any:`run` returns, i.e. when the
+:any:`Runner` is :any:`finished` or :any:`stopped`. If :any:`run` raises an
+exception, then the same exception is set on the returned future.
+
+Cancelling the returned future calls :any:`kill`.
+
+To use this function from :any:`asyncio`, wrap the returned future with
+:any:`asyncio.wrap_future`:
+
+.. code-block:: python
+
+   await asyncio.wrap_future(tc.run_async())
+
+Any :any:`Runner` objects that are still running when the interpreter exits
+are killed.
+
+:returns: A future that is resolved when the :any:`Runner` stops.
+:rtype: concurrent.futures.Future
+
+:raises LibsemigroupsError: if *self* is already running.
+
+.. seealso::  :any:`run_for_async`.
+)pbdoc");
+    thing.def(
+        "run_for_async",
+        [](py::object self, std::chrono::nanoseconds t) {
+          return run_async(self, [t](Runner& r) { r.run_for(t); });
+        },
+        py::arg("t"),
+        R"pbdoc(
+:sig=(self: Runner, t: datetime.timedelta) -> concurrent.futures.Future:
+
+Run for a specified amount of time, asynchronously.
+
+This function is the same as :any:`run_async` except that :any:`run_for` is
+called with argument *t* rather than :any:`run`.
+
+:param t: the time to run for.
+:type t: datetime.timedelta
+
+:returns: A future that is resolved when the :any:`Runner` stops.
+:rtype: concurrent.futures.Future
+
+:raises LibsemigroupsError: if *self* is already running.
+
+.. seealso::  :any:`run_async`.
+)pbdoc");
+    // This overload must be defined before the one for arbitrary callables,
+    // since StopCondition objects are callable too.
+    thing.def(
+        "run_until",
+        [](Runner& self, StopCondition const& cond) {
+          std::function<bool()> func(cond);
+          run_releasing_gil(self, "Runner.run_until", [&self, &func]() {
+            self.run_until(func);
+          });
+        },
+        py::arg("cond"),
+        R"pbdoc(
+:sig=(self: Runner, cond: StopCondition) -> None:
+:only-document-once:
+
+Run until a stop condition is satisfied or finished.
+
+This function is the same as :any:`run_until` with a nullary function as
+argument, except that *cond* is a :any:`StopCondition` which is evaluated
+entirely in C++, without reacquiring the GIL. This is usually much faster than
+using a Python function, since the condition might be checked very often.
+
+:param cond: the condition that will be used to determine when to stop running.
+:type cond: StopCondition
+
+.. seealso::  :any:`runner` for functions that create :any:`StopCondition`
+   objects.
+)pbdoc");
+    thing.def(
+        "run_until",
+        [](Runner& self, std::function<bool()>& func) {
+          run_releasing_gil(self, "Runner.run_until", [&self, &func]() {
+            self.run_until(func);
+          });
+        },
+        py::arg("func"),
+        R"pbdoc(
 Run until a nullary predicate returns true or finished.
 
+The GIL is released, and interrupts are handled, as described in :any:`run`.
+The GIL is reacquired every time that *func* is called.
+
 :param func:
    a nullary function that will be used to determine when to stop running.
 
@@ -689,6 +1010,327 @@ as given by :any:`state`.
 :complexity:
    Constant.
 )pbdoc");
+
+    py::class_<StopCondition> stop(m,
+                                   "StopCondition",
+                                   R"pbdoc(
+A condition for stopping a :any:`Runner`.
+
+Objects of this type can be used as the argument of :any:`Runner.run_until`,
+and are evaluated entirely in C++, without involving Python. Such objects
+should be created using the functions in the :any:`runner` subpackage, for
+example, :any:`runner.current_size_at_least` or
+:any:`runner.number_of_nodes_active_at_least`, and can be combined using ``&``
+(and), ``|`` (or), and ``~`` (not).
+
+.. doctest:: Python
+
+   >>> from libsemigroups_pybind11 import (Presentation, presentation, ToddCoxeter,
+   ... congruence_kind, runner)
+   >>> p = Presentation("ab")
+   >>> presentation.add_rule(p, "aaa", "a")
+   >>> tc = ToddCoxeter(congruence_kind.twosided, p)
+   >>> tc.run_until(runner.number_of_nodes_active_at_least(tc, 100)
+   ... | runner.resident_set_size_at_least(2 ** 40))
+   >>> tc.number_of_nodes_active() >= 100
+   True
+)pbdoc");
+    stop.def("__call__",
+             &StopCondition::operator(),
+             R"pbdoc(
+:sig=(self: StopCondition) -> bool:
+
+Check whether or not the condition is satisfied.
+
+:returns: Whether or not the condition is satisfied.
+:rtype: bool
+)pbdoc");
+    stop.def(
+        "__and__",
+        [](StopCondition const& self, StopCondition const& that) {
+          return StopCondition([self, that]() { return self() && that(); });
+        },
+        py::is_operator(),
+        py::keep_alive<0, 1>(),
+        py::keep_alive<0, 2>());
+    stop.def(
+        "__or__",
+        [](StopCondition const& self, StopCondition const& that) {
+          return StopCondition([self, that]() { return self() || that(); });
+        },
+        py::is_operator(),
+        py::keep_alive<0, 1>(),
+        py::keep_alive<0, 2>());
+    stop.def(
+        "__invert__",
+        [](StopCondition const& self) {
+          return StopCondition([self]() { return !self(); });
+        },
+        py::keep_alive<0, 1>());
+
+    m.def(
+        "runner_resident_set_size_at_least",
+        [](size_t n) {
+          return StopCondition(
+              [n,
+               next_check = std::chrono::steady_clock::time_point(),
+               result     = false]() mutable {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= next_check) {
+                  result     = resident_set_size() >= n;
+                  next_check = now + memory_check_interval;
+                }
+                return result;
+              });
+        },
+        py::arg("n"),
+        R"pbdoc(
+:sig=(n: int) -> StopCondition:
+
+Returns a condition that is satisfied when the memory used by the process
+reaches a given number of bytes.
+
+This function returns a :any:`StopCondition` that is satisfied when the
+resident set size of the current process, i.e. the amount of physical memory
+it occupies, is at least *n* bytes. The resident set size is checked at most
+once per millisecond. This can be used to stop a :any:`Runner` before it
+exhausts the available memory.
+
+On platforms other than Linux and macOS, the resident set size cannot be
+determined, and the returned condition is never satisfied.
+
+:param n: the number of bytes.
+:type n: int
+
+:returns: A stop condition.
+:rtype: StopCondition
+)pbdoc");
+
+    py::class_<MetricsStream> metrics(m,
+                                      "MetricsStream",
+                                      R"pbdoc(
+A buffer of samples of the progress of :any:`Runner` objects.
+
+Objects of this type store samples recorded by the :any:`StopCondition`
+returned by :any:`runner.record_metrics`, while a :any:`Runner` is running, in
+a fixed size lock-free ring buffer. The samples can be collected, from any
+thread, using :any:`drain`, for example, to export them to a monitoring system.
+Recording a sample never blocks the :any:`Runner`; if the buffer is full, then
+new samples are discarded, and counted by :any:`dropped`.
+
+.. doctest:: Python
+
+   >>> from datetime import timedelta
+   >>> from libsemigroups_pybind11 import (Presentation, presentation,
+   ... ToddCoxeter, congruence_kind, runner)
+   >>> p = Presentation("ab")
+   >>> presentation.add_rule(p, "aaa", "a")
+   >>> tc = ToddCoxeter(congruence_kind.twosided, p)
+   >>> stream = runner.MetricsStream(1024, timedelta(milliseconds=1))
+   >>> tc.run_until(runner.record_metrics(tc, stream)
+   ...              | runner.number_of_nodes_active_at_least(tc, 10000))
+   >>> samples = stream.drain()
+   >>> len(samples) > 0
+   True
+   >>> sorted(samples[0].keys())
+   ['count', 'name', 'rate', 'thread_id', 'timestamp']
+   >>> samples[0]['name']
+   'nodes'
+)pbdoc");
+    metrics.def(py::init<size_t, std::chrono::nanoseconds>(),
+                py::arg("capacity") = 1024,
+                py::arg("interval") = std::chrono::milliseconds(100),
+                R"pbdoc(
+:sig=(self: MetricsStream, capacity: int = 1024, interval: datetime.timedelta = datetime.timedelta(milliseconds=100)) -> None:
+
+Construct a :any:`MetricsStream`.
+
+:param capacity:
+   the maximum number of samples held at any time, which is rounded up to the
+   next power of ``2`` (defaults to ``1024``).
+:type capacity: int
+
+:param interval:
+   the minimum time between two samples recorded from the same
+   :any:`StopCondition` (defaults to 100 milliseconds).
+:type interval: datetime.timedelta
+
+:raises LibsemigroupsError: if *capacity* is ``0``.
+)pbdoc");
+    metrics.def("capacity",
+                &MetricsStream::capacity,
+                R"pbdoc(
+:sig=(self: MetricsStream) -> int:
+
+Returns the maximum number of samples held at any time.
+
+:returns: The capacity.
+:rtype: int
+)pbdoc");
+    metrics.def("interval",
+                &MetricsStream::interval,
+                R"pbdoc(
+:sig=(self: MetricsStream) -> datetime.timedelta:
+
+Returns the minimum time between two samples.
+
+:returns: The sampling interval.
+:rtype: datetime.timedelta
+)pbdoc");
+    metrics.def("dropped",
+                &MetricsStream::dropped,
+                R"pbdoc(
+:sig=(self: MetricsStream) -> int:
+
+Returns the number of samples discarded because the buffer was full.
+
+:returns: The number of discarded samples.
+:rtype: int
+)pbdoc");
+    metrics.def(
+        "drain",
+        [](MetricsStream& self) {
+          py::list      result;
+          MetricsSample sample;
+          while (self.pop(sample)) {
+            py::dict d;
+            d["timestamp"] = sample.timestamp;
+            d["count"]     = sample.count;
+            d["rate"]      = sample.rate;
+            d["name"]      = sample.name;
+            d["thread_id"] = sample.thread_id;
+            result.append(std::move(d));
+          }
+          return result;
+        },
+        R"pbdoc(
+:sig=(self: MetricsStream) -> list[dict[str, int | float | str]]:
+
+Remove and return all of the samples in the buffer.
+
+This function removes all of the samples currently in the buffer, and returns
+them, oldest first, as a list of dictionaries with the following keys:
+
+* ``"timestamp"``: the time the sample was taken, in seconds since the epoch
+  (as returned by :any:`time.time`);
+* ``"count"``: the value of the counter, for example, the number of active
+  nodes of a :any:`ToddCoxeter` instance;
+* ``"rate"``: the change in ``"count"`` per second since the previous sample
+  from the same :any:`StopCondition`;
+* ``"name"``: the name of the counter, one of ``"elements"``, ``"nodes"``, or
+  ``"rules"``;
+* ``"thread_id"``: an integer identifying the native thread where the sample
+  was taken.
+
+This function can be called while a :any:`Runner` is running in another
+thread, and does not slow that :any:`Runner` down.
+
+:returns: The samples.
+:rtype: list[dict[str, int | float | str]]
+)pbdoc");
+
+    py::class_<RaceResult> race_result(m,
+                                       "RaceResult",
+                                       R"pbdoc(
+The result of :any:`runner.race`.
+
+Objects of this type record which of the :any:`Runner` objects in a call to
+:any:`runner.race` finished first, and for how long each of them ran.
+)pbdoc");
+    race_result.def(
+        "winner",
+        [](RaceResult const& self) { return from_int(self.winner); },
+        R"pbdoc(
+:sig=(self: RaceResult) -> int | Undefined:
+
+Returns the index of the winner.
+
+This function returns the index, in the list passed to :any:`runner.race`, of
+the :any:`Runner` that finished first, or :any:`UNDEFINED` if none of them
+finished.
+
+:returns: The index of the winner.
+:rtype: int | Undefined
+)pbdoc");
+    race_result.def(
+        "run_times",
+        [](RaceResult const& self) { return self.run_times; },
+        R"pbdoc(
+:sig=(self: RaceResult) -> list[datetime.timedelta]:
+
+Returns how long each :any:`Runner` ran for.
+
+This function returns a list whose item in position ``i`` is how long the
+:any:`Runner` in position ``i`` in the list passed to :any:`runner.race` ran
+for. Any :any:`Runner` that was killed before it started has run time ``0``.
+
+:returns: The run times.
+:rtype: list[datetime.timedelta]
+)pbdoc");
+
+    m.def(
+        "runner_race",
+        [](std::vector<Runner*> const& runners, size_t max_threads) {
+          return call_releasing_gil(
+              "runner.race",
+              [&runners, max_threads]() { return race(runners, max_threads); },
+              [&runners]() {
+                for (auto* r : runners) {
+                  r->kill();
+                }
+              });
+        },
+        py::arg("runners"),
+        py::arg("max_threads") = 0,
+        R"pbdoc(
+:sig=(runners: list[Runner], max_threads: int = 0) -> RaceResult:
+
+Run several :any:`Runner` objects in parallel until one of them finishes.
+
+This function runs the :any:`Runner` objects in *runners* using at most
+*max_threads* native threads, without holding the GIL. If there are more
+runners than threads, then the runners are started in the order they appear in
+*runners* as threads become available. As soon as one of the runners is
+:any:`Runner.finished`, all of the others are killed (see :any:`Runner.kill`),
+and this function returns once they have all stopped. The runners can be of
+different types, or differently configured instances of the same type, for
+example, :any:`ToddCoxeter` instances using different strategies.
+
+If none of the runners finishes, and any of them raised an exception, then the
+first such exception is raised. If this function is interrupted (for example,
+by pressing Ctrl-C), then all of the runners are killed.
+
+:param runners: the runners.
+:type runners: list[Runner]
+
+:param max_threads:
+   the maximum number of threads to use; if this is ``0`` (the default), then
+   the number of hardware threads is used.
+:type max_threads: int
+
+:returns: The index of the winner, and how long each runner ran for.
+:rtype: RaceResult
+
+.. doctest:: Python
+
+   >>> from libsemigroups_pybind11 import (Presentation, presentation,
+   ... ToddCoxeter, congruence_kind, runner)
+   >>> p = Presentation("ab")
+   >>> presentation.add_rule(p, "aaa", "a")
+   >>> presentation.add_rule(p, "bb", "b")
+   >>> presentation.add_rule(p, "ab", "ba")
+   >>> hlt = ToddCoxeter(congruence_kind.twosided, p)
+   >>> hlt.strategy(ToddCoxeter.options.strategy.hlt)
+   <2-sided ToddCoxeter over <semigroup presentation with 2 letters, 3 rules, and length 10> with 0 gen. pairs + 1 node>
+   >>> felsch = ToddCoxeter(congruence_kind.twosided, p)
+   >>> felsch.strategy(ToddCoxeter.options.strategy.felsch)
+   <2-sided ToddCoxeter over <semigroup presentation with 2 letters, 3 rules, and length 10> with 0 gen. pairs + 1 node>
+   >>> result = runner.race([hlt, felsch])
+   >>> result.winner() in (0, 1)
+   True
+   >>> len(result.run_times())
+   2
+)pbdoc");
   }  // init_runner
 
 }  // namespace libsemigroups
@@ -0,0 +1,162 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_RUNNER_HPP_
+#define SRC_RUNNER_HPP_
+
+// C++ stl headers....
+#include <chrono>       // for milliseconds
+#include <cstddef>      // for size_t
+#include <functional>   // for function
+#include <future>       // for packaged_task, future_status
+#include <thread>       // for thread
+#include <type_traits>  // for invoke_result_t
+#include <utility>      // for forward, move
+#include <vector>       // for vector
+
+// libsemigroups headers
+#include <libsemigroups/runner.hpp>  // for Runner
+
+// pybind11....
+#include <pybind11/pybind11.h>
+
+// libsemigroups_pybind11....
+#include "trace.hpp"  // for TraceScope
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  // How often the Python main thread checks for signals (such as SIGINT from
+  // Ctrl-C) while a Runner is running in another thread.
+  constexpr std::chrono::milliseconds signal_check_interval(10);
+
+  // The minimum time between two checks of the memory used, for example, by
+  // the StopCondition returned by runner_resident_set_size_at_least.
+  constexpr std::chrono::milliseconds memory_check_interval(1);
+
+  // A nullary predicate, for use with Runner::run_until, that is implemented
+  // entirely in C++, and so can be called without the GIL.
+  class StopCondition {
+   public:
+    explicit StopCondition(std::function<bool()> pred)
+        : _pred(std::move(pred)) {}
+
+    bool operator()() const {
+      return _pred();
+    }
+
+   private:
+    std::function<bool()> _pred;
+  };
+
+  // Calls func(t) for every t in [0, threads), each in its own thread, and
+  // func(0) in the calling thread.
+  template <typename Func>
+  void for_each_thread(size_t threads, Func&& func) {
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; ++t) {
+      workers.emplace_back(func, t);
+    }
+    func(0);
+    for (auto& w : workers) {
+      w.join();
+    }
+  }
+
+  // Returns the resident set size of the current process in bytes, or 0 if
+  // this cannot be determined on the current platform.
+  size_t resident_set_size();
+
+  // Returns true if called from the Python main thread, i.e. the only thread
+  // in which Python signal handlers are ever run. Must be called with the GIL
+  // held.
+  bool is_python_main_thread();
+
+  // Call func with the GIL released, so that other Python threads can make
+  // progress in the meantime, calling kill() if func is interrupted. If tracing
+  // is enabled, then the call to func is recorded as a phase called name.
+  //
+  // If this function is called from the Python main thread, then func is
+  // called in a new thread, and the main thread periodically checks for
+  // signals. If a signal handler raises an exception (the default SIGINT
+  // handler raises KeyboardInterrupt), then kill() is called, which should
+  // cause func to return promptly, we wait for func to return, and the
+  // exception is propagated. Any exception thrown by func is propagated too.
+  //
+  // Must be called with the GIL held.
+  template <typename Func, typename Kill>
+  std::invoke_result_t<Func> call_releasing_gil(char const* name,
+                                                Func&&      func,
+                                                Kill&&      kill) {
+    using return_type = std::invoke_result_t<Func>;
+
+    if (!is_python_main_thread()) {
+      py::gil_scoped_release release;
+      TraceScope             trace(name);
+      return func();
+    }
+
+    std::packaged_task<return_type()> task(
+        [name, &func]() -> return_type {
+          TraceScope trace(name);
+          return func();
+        });
+    auto                              result = task.get_future();
+    bool                              interrupted = false;
+    {
+      py::gil_scoped_release release;
+      std::thread            worker(std::move(task));
+      while (result.wait_for(signal_check_interval)
+             != std::future_status::ready) {
+        py::gil_scoped_acquire acquire;
+        if (PyErr_CheckSignals() != 0) {
+          interrupted = true;
+          kill();
+          break;
+        }
+      }
+      worker.join();
+    }
+    if (interrupted) {
+      // The Python error indicator was set by PyErr_CheckSignals
+      throw py::error_already_set();
+    }
+    return result.get();
+  }
+
+  // Call func, which should run r in some way (for example by calling
+  // r.run(), or a member function of a derived class of Runner that triggers
+  // r.run()), as in call_releasing_gil, calling r.kill() if func is
+  // interrupted. If r is already finished, then no new thread is created.
+  //
+  // Must be called with the GIL held.
+  template <typename Func>
+  std::invoke_result_t<Func> run_releasing_gil(Runner&     r,
+                                               char const* name,
+                                               Func&&      func) {
+    if (r.finished()) {
+      py::gil_scoped_release release;
+      TraceScope             trace(name);
+      return func();
+    }
+    return call_releasing_gil(
+        name, std::forward<Func>(func), [&r]() { r.kill(); });
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_RUNNER_HPP_
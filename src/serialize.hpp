@@ -0,0 +1,91 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_SERIALIZE_HPP_
+#define SRC_SERIALIZE_HPP_
+
+// C++ stl headers....
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <fstream>      // for ofstream
+#include <string>       // for string
+#include <type_traits>  // for is_trivially_copyable_v
+
+// libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+
+namespace libsemigroups {
+
+  // A binary file of fixed size values written in the native byte order,
+  // starting with a 4 byte magic string, and a version number. Such files are
+  // not portable between platforms with different byte orders.
+  class BinaryWriter {
+   public:
+    BinaryWriter(std::string const& filename,
+                 char const (&magic)[5],
+                 uint32_t version)
+        : _file(filename, std::ios::binary), _filename(filename) {
+      if (!_file) {
+        LIBSEMIGROUPS_EXCEPTION("cannot open the file {} for writing",
+                                filename);
+      }
+      write_bytes(magic, 4);
+      write(version);
+    }
+
+    void write_bytes(void const* data, size_t n) {
+      _file.write(static_cast<char const*>(data),
+                  static_cast<std::streamsize>(n));
+    }
+
+    template <typename T>
+    void write(T const& x) {
+      static_assert(std::is_trivially_copyable_v<T>);
+      write_bytes(&x, sizeof(T));
+    }
+
+    // Writes zero bytes until the file position is a multiple of alignment,
+    // so that the next value can be memory mapped.
+    void align(size_t alignment) {
+      auto pos = static_cast<size_t>(_file.tellp());
+      for (; pos % alignment != 0; ++pos) {
+        _file.put('\0');
+      }
+    }
+
+    // Must be called to check that everything was written successfully.
+    void close() {
+      _file.close();
+      if (!_file) {
+        LIBSEMIGROUPS_EXCEPTION("failed to write to the file {}", _filename);
+      }
+    }
+
+    // Closes the file without checking that everything was written, for use
+    // when the file is about to be deleted.
+    void close_no_checks() noexcept {
+      _file.close();
+    }
+
+   private:
+    std::ofstream _file;
+    std::string   _filename;
+  };
+}  // namespace libsemigroups
+
+#endif  // SRC_SERIALIZE_HPP_
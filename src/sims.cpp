@@ -18,7 +18,23 @@
 
 // C++ stl headers....
 #include <pybind11/detail/common.h>
-#include <vector>  // for vector
+#include <algorithm>   // for find_if, max, min, remove_if
+#include <atomic>      // for atomic
+#include <chrono>      // for steady_clock, microseconds
+#include <cstdint>     // for uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstdio>      // for remove
+#include <cstring>     // for memcpy
+#include <exception>   // for exception_ptr, current_exception
+#include <functional>  // for function
+#include <limits>      // for numeric_limits
+#include <memory>      // for unique_ptr, make_unique, shared_ptr, weak_ptr
+#include <mutex>       // for mutex, lock_guard
+#include <numeric>     // for accumulate
+#include <optional>    // for optional
+#include <string>      // for string
+#include <thread>      // for thread, this_thread
+#include <utility>     // for pair
+#include <vector>      // for vector
 
 // libsemigroups....
 #include <libsemigroups/presentation.hpp>  // for Presentation
@@ -29,11 +45,17 @@
 
 // pybind11....
 #include <pybind11/functional.h>
+#include <pybind11/chrono.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
 // libsemigroups_pybind11....
-#include "main.hpp"  // for init_sims
+#include "bounded-queue.hpp"  // for BoundedQueue
+#include "main.hpp"           // for init_sims
+#include "runner.hpp"         // for is_python_main_thread, call_releasing_gil
+#include "serialize.hpp"      // for BinaryWriter
+#include "trace.hpp"          // for TraceScope, intern_trace_name
 
 namespace libsemigroups {
   namespace py          = pybind11;
@@ -41,6 +63,746 @@ namespace libsemigroups {
   using word_graph_type = WordGraph<node_type>;
   using size_type       = typename word_graph_type::size_type;
 
+  //////////////////////////////////////////////////////////////////////////////
+  // SimsPredicate
+  //////////////////////////////////////////////////////////////////////////////
+
+  // A predicate on word graphs implemented entirely in C++, that only reads
+  // its (immutable) data, and so can be called concurrently by the Sims worker
+  // threads without the GIL.
+  class SimsPredicate {
+   public:
+    using function_type = std::function<bool(word_graph_type const&)>;
+
+    // The string expr is used in the repr, and letters is one more than the
+    // largest letter in any word used by func.
+    SimsPredicate(function_type func, std::string expr, size_t letters)
+        : _func(std::move(func)), _expr(std::move(expr)), _letters(letters) {}
+
+    bool operator()(word_graph_type const& wg) const {
+      return _func(wg);
+    }
+
+    [[nodiscard]] function_type const& function() const noexcept {
+      return _func;
+    }
+
+    [[nodiscard]] std::string const& expr() const noexcept {
+      return _expr;
+    }
+
+    [[nodiscard]] size_t letters() const noexcept {
+      return _letters;
+    }
+
+    // Returns the function used by a search, which is only called if the
+    // out-degree of the word graph is at least letters(), since the words are
+    // followed without checks, and which otherwise returns false. The
+    // presentation of a search can be replaced after the predicate is added,
+    // and the function is called in the threads of the search, where it
+    // cannot throw.
+    [[nodiscard]] function_type checked_function() const {
+      if (_letters == 0) {
+        return _func;
+      }
+      return [func = _func, letters = _letters](word_graph_type const& wg) {
+        return wg.out_degree() >= letters && func(wg);
+      };
+    }
+
+    // Called before the predicate is used, so that an out of bounds letter is
+    // reported when possible, rather than silently rejecting every word graph.
+    void throw_if_letter_out_of_bounds(size_t out_degree) const {
+      if (_letters > out_degree) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the predicate {} contains the letter {}, but the out-degree of "
+            "the word graph is {}",
+            _expr,
+            _letters - 1,
+            out_degree);
+      }
+    }
+
+   private:
+    function_type _func;
+    std::string   _expr;
+    size_t        _letters;
+  };
+
+  namespace {
+    std::string word_repr(word_type const& w) {
+      std::string result = "[";
+      for (size_t i = 0; i < w.size(); ++i) {
+        result += fmt::format("{}{}", i == 0 ? "" : ", ", w[i]);
+      }
+      return result + "]";
+    }
+
+    size_t letters(std::vector<word_type> const& words) {
+      size_t result = 0;
+      for (auto const& w : words) {
+        for (auto a : w) {
+          result = std::max(result, static_cast<size_t>(a) + 1);
+        }
+      }
+      return result;
+    }
+
+    // Returns the last node on the path from source labelled by w, or
+    // UNDEFINED if there is no such path.
+    node_type follow(word_graph_type const& wg,
+                     node_type              source,
+                     word_type const&       w) {
+      for (auto a : w) {
+        if (source == UNDEFINED) {
+          break;
+        }
+        source = wg.target_no_checks(source, a);
+      }
+      return source;
+    }
+
+    // Returns the nodes reachable from 0, which are the nodes defined so far
+    // in a word graph in the search tree of Sims1 or Sims2. Other nodes may
+    // exist, but have no edges incident to them.
+    std::vector<node_type> active_nodes(word_graph_type const& wg) {
+      std::vector<node_type> result;
+      if (wg.number_of_nodes() == 0) {
+        return result;
+      }
+      std::vector<bool> seen(wg.number_of_nodes(), false);
+      result.push_back(0);
+      seen[0] = true;
+      for (size_t i = 0; i < result.size(); ++i) {
+        for (size_t a = 0; a < wg.out_degree(); ++a) {
+          node_type t = wg.target_no_checks(result[i], a);
+          if (t != UNDEFINED && !seen[t]) {
+            seen[t] = true;
+            result.push_back(t);
+          }
+        }
+      }
+      return result;
+    }
+
+    bool is_complete(word_graph_type const&        wg,
+                     std::vector<node_type> const& nodes) {
+      for (auto s : nodes) {
+        for (size_t a = 0; a < wg.out_degree(); ++a) {
+          if (wg.target_no_checks(s, a) == UNDEFINED) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    SimsPredicate max_nodes(size_t n) {
+      return SimsPredicate(
+          [n](word_graph_type const& wg) {
+            return active_nodes(wg).size() <= n;
+          },
+          fmt::format("max_nodes({})", n),
+          0);
+    }
+
+    SimsPredicate compatible_with(std::vector<word_type> const& rules) {
+      if (rules.size() % 2 != 0) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "expected a list of even length, found length {}", rules.size());
+      }
+      return SimsPredicate(
+          [rules](word_graph_type const& wg) {
+            for (node_type s = 0; s < wg.number_of_nodes(); ++s) {
+              for (size_t i = 0; i < rules.size(); i += 2) {
+                node_type x = follow(wg, s, rules[i]);
+                if (x != UNDEFINED) {
+                  node_type y = follow(wg, s, rules[i + 1]);
+                  if (y != UNDEFINED && x != y) {
+                    return false;
+                  }
+                }
+              }
+            }
+            return true;
+          },
+          fmt::format("compatible_with({} rules)", rules.size() / 2),
+          letters(rules));
+    }
+
+    SimsPredicate not_identified(word_type const& u, word_type const& v) {
+      return SimsPredicate(
+          [u, v](word_graph_type const& wg) {
+            if (wg.number_of_nodes() == 0) {
+              return true;
+            }
+            node_type x = follow(wg, 0, u);
+            return x == UNDEFINED || x != follow(wg, 0, v);
+          },
+          fmt::format("not_identified({}, {})", word_repr(u), word_repr(v)),
+          letters({u, v}));
+    }
+
+    SimsPredicate faithful_on(std::vector<word_type> const& words) {
+      return SimsPredicate(
+          [words](word_graph_type const& wg) {
+            auto nodes = active_nodes(wg);
+            if (!is_complete(wg, nodes)) {
+              return true;
+            }
+            for (size_t i = 0; i < words.size(); ++i) {
+              for (size_t j = i + 1; j < words.size(); ++j) {
+                if (std::all_of(nodes.cbegin(), nodes.cend(), [&](auto s) {
+                      return follow(wg, s, words[i])
+                             == follow(wg, s, words[j]);
+                    })) {
+                  return false;
+                }
+              }
+            }
+            return true;
+          },
+          fmt::format("faithful_on({} words)", words.size()),
+          letters(words));
+    }
+
+    SimsPredicate strictly_cyclic() {
+      return SimsPredicate(
+          [](word_graph_type const& wg) {
+            auto nodes = active_nodes(wg);
+            if (!is_complete(wg, nodes)) {
+              return true;
+            }
+            // Every node is reachable from 0, and so some node is the source
+            // of a non-empty path to every node if and only if 0 has an
+            // in-edge.
+            for (auto s : nodes) {
+              for (size_t a = 0; a < wg.out_degree(); ++a) {
+                if (wg.target_no_checks(s, a) == 0) {
+                  return true;
+                }
+              }
+            }
+            return false;
+          },
+          "strictly_cyclic()",
+          0);
+    }
+  }  // namespace
+
+  //////////////////////////////////////////////////////////////////////////////
+  // SimsThreadStats
+  //////////////////////////////////////////////////////////////////////////////
+
+  // Per-thread statistics of a search, recorded by a pruner that accepts every
+  // word graph, and so is called once for every node of the search tree that
+  // is visited, in the thread visiting it. Each thread that calls the pruner
+  // gets its own slot of counters, on its own cache line, which only that
+  // thread writes to, and so recording never locks, and the counters can be
+  // read at any time, including while the search is running.
+  class SimsThreadStats {
+   public:
+    // The depth is computed at most once in this many calls in each thread,
+    // since it is proportional to the size of the word graph.
+    static constexpr uint64_t depth_sample_interval = 64;
+
+    struct alignas(64) Slot {
+      std::atomic<uint64_t> nodes{0};
+      std::atomic<uint64_t> idle_ns{0};
+      std::atomic<uint64_t> idle_periods{0};
+      std::atomic<uint64_t> depth{0};
+      std::atomic<uint64_t> max_depth{0};
+    };
+
+    SimsThreadStats(size_t max_threads, std::chrono::nanoseconds idle)
+        : _data(std::make_shared<Data>(max_threads, idle)) {
+      if (max_threads == 0) {
+        LIBSEMIGROUPS_EXCEPTION("the argument max_threads must be non-zero");
+      }
+    }
+
+    SimsPredicate pruner() const {
+      return SimsPredicate(
+          [data = _data](word_graph_type const& wg) {
+            data->record(wg);
+            return true;
+          },
+          "thread_stats()",
+          0);
+    }
+
+    [[nodiscard]] size_t number_of_threads() const noexcept {
+      return std::min(_data->used.load(), _data->capacity);
+    }
+
+    [[nodiscard]] size_t max_threads() const noexcept {
+      return _data->capacity;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds idle_threshold() const noexcept {
+      return _data->idle;
+    }
+
+    template <typename Func>
+    std::vector<uint64_t> collect(Func&& func) const {
+      std::vector<uint64_t> result;
+      for (size_t i = 0; i < number_of_threads(); ++i) {
+        result.push_back(func(_data->slots[i]));
+      }
+      return result;
+    }
+
+    // Forget all threads and zero all counters; threads calling the pruner
+    // afterwards get new slots.
+    void reset() {
+      _data->id = next_id();
+      _data->used = 0;
+      for (size_t i = 0; i < _data->capacity; ++i) {
+        auto& slot        = _data->slots[i];
+        slot.nodes        = 0;
+        slot.idle_ns      = 0;
+        slot.idle_periods = 0;
+        slot.depth        = 0;
+        slot.max_depth    = 0;
+      }
+    }
+
+   private:
+    static uint64_t next_id() {
+      static std::atomic<uint64_t> id(0);
+      return ++id;
+    }
+
+    struct Data : std::enable_shared_from_this<Data> {
+      Data(size_t max_threads, std::chrono::nanoseconds idle_threshold)
+          : slots(new Slot[max_threads]),
+            capacity(max_threads),
+            used(0),
+            id(next_id()),
+            idle(idle_threshold) {}
+
+      std::unique_ptr<Slot[]>  slots;
+      size_t                   capacity;
+      std::atomic<size_t>      used;
+      std::atomic<uint64_t>    id;
+      std::chrono::nanoseconds idle;
+
+      void record(word_graph_type const& wg) {
+        using std::chrono::steady_clock;
+        struct Local {
+          std::weak_ptr<Data const> data;
+          uint64_t                  id;
+          size_t                    slot;
+          uint64_t                  calls;
+          steady_clock::time_point  last;
+        };
+        // The threads of a search may record stats for more than one object,
+        // and an object gets a new id whenever it is reset.
+        thread_local std::vector<Local> locals;
+
+        auto now     = steady_clock::now();
+        auto this_id = id.load(std::memory_order_relaxed);
+        auto it      = std::find_if(
+            locals.begin(), locals.end(), [this_id](auto const& x) {
+              return x.id == this_id;
+            });
+        if (it == locals.end()) {
+          // Forget the objects that were destroyed or reset since this thread
+          // last recorded stats for them, so that locals does not grow with
+          // every reset, and the search above stays short.
+          locals.erase(std::remove_if(locals.begin(),
+                                      locals.end(),
+                                      [](Local const& x) {
+                                        auto data = x.data.lock();
+                                        return data == nullptr
+                                               || data->id.load() != x.id;
+                                      }),
+                       locals.end());
+          // Threads beyond max_threads share the last slot
+          size_t slot = std::min(used++, capacity - 1);
+          locals.push_back(Local{weak_from_this(), this_id, slot, 0, now});
+          it = locals.end() - 1;
+        }
+        Slot& slot = slots[it->slot];
+        auto  gap  = now - it->last;
+        if (it->calls != 0 && gap >= idle) {
+          slot.idle_ns.fetch_add(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(gap).count(),
+              std::memory_order_relaxed);
+          slot.idle_periods.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (it->calls % depth_sample_interval == 0) {
+          uint64_t depth = active_nodes(wg).size();
+          slot.depth.store(depth, std::memory_order_relaxed);
+          if (depth > slot.max_depth.load(std::memory_order_relaxed)) {
+            slot.max_depth.store(depth, std::memory_order_relaxed);
+          }
+        }
+        it->last = now;
+        it->calls++;
+        slot.nodes.fetch_add(1, std::memory_order_relaxed);
+      }
+    };
+
+    std::shared_ptr<Data> _data;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  // SimsResultQueue
+  //////////////////////////////////////////////////////////////////////////////
+
+  // Runs find_if for a copy of a Sims1 or Sims2 object in a background thread,
+  // and so in number_of_threads() worker threads, which push every word graph
+  // found into a bounded queue, and never touch any Python object. The word
+  // graphs are popped from the queue, by the thread holding the GIL, in next.
+  class SimsResultQueue {
+   public:
+    // The name is used for tracing.
+    template <typename Thing>
+    SimsResultQueue(Thing const& sims,
+                    char const*  name,
+                    size_type    n,
+                    size_t       capacity)
+        : _queue(capacity), _stop(false), _done(false), _error(), _thread() {
+      if (n == 0) {
+        LIBSEMIGROUPS_EXCEPTION("the argument n must be non-zero");
+      } else if (sims.presentation().alphabet().empty()
+                 && sims.presentation().rules.empty()) {
+        LIBSEMIGROUPS_EXCEPTION(
+            "the presentation must not have 0 generators and 0 relations");
+      }
+      // Once _stop is set, this pruner rejects every word graph, and so every
+      // worker thread backtracks to the root of the search tree promptly,
+      // without waiting to find another word graph.
+      Thing copy(sims);
+      copy.add_pruner([this](word_graph_type const&) {
+        return !_stop.load(std::memory_order_relaxed);
+      });
+      _thread = std::thread([this, copy = std::move(copy), name, n]() {
+        try {
+          TraceScope trace(name);
+          copy.find_if(n, [this](word_graph_type const& wg) {
+            return !push(wg);
+          });
+        } catch (...) {
+          _error = std::current_exception();
+        }
+        _done.store(true, std::memory_order_release);
+      });
+    }
+
+    SimsResultQueue(SimsResultQueue const&)            = delete;
+    SimsResultQueue& operator=(SimsResultQueue const&) = delete;
+
+    ~SimsResultQueue() {
+      _stop = true;
+      if (_thread.joinable()) {
+        if (PyGILState_Check()) {
+          py::gil_scoped_release release;
+          _thread.join();
+        } else {
+          _thread.join();
+        }
+      }
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+      return _queue.capacity();
+    }
+
+    // Returns the next word graph found, or std::nullopt if there are no
+    // more, waiting with the GIL released if none is available yet. Must be
+    // called with the GIL held.
+    std::optional<word_graph_type> next() {
+      using std::chrono::steady_clock;
+      word_graph_type result;
+      if (_queue.try_pop(result)) {
+        return result;
+      }
+      bool const main        = is_python_main_thread();
+      bool       found       = false;
+      bool       interrupted = false;
+      {
+        py::gil_scoped_release release;
+        auto   next_check = steady_clock::now() + signal_check_interval;
+        size_t spins      = 0;
+        for (;;) {
+          // Read _done before popping, so that no word graph pushed before
+          // _done was set can be missed.
+          bool done = _done.load(std::memory_order_acquire);
+          if (_queue.try_pop(result)) {
+            found = true;
+            break;
+          } else if (done) {
+            break;
+          } else if (++spins < 64) {
+            std::this_thread::yield();
+          } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+          }
+          if (main && steady_clock::now() >= next_check) {
+            py::gil_scoped_acquire acquire;
+            if (PyErr_CheckSignals() != 0) {
+              interrupted = true;
+              break;
+            }
+            next_check = steady_clock::now() + signal_check_interval;
+          }
+        }
+      }
+      if (interrupted) {
+        close();
+        // The Python error indicator was set by PyErr_CheckSignals
+        throw py::error_already_set();
+      } else if (found) {
+        return result;
+      }
+      close();
+      if (_error) {
+        std::exception_ptr error = _error;
+        _error                   = nullptr;
+        std::rethrow_exception(error);
+      }
+      return std::nullopt;
+    }
+
+    // Stops the search, waits for it to stop, and discards any word graphs in
+    // the queue. Must be called with the GIL held.
+    void close() {
+      _stop = true;
+      if (_thread.joinable()) {
+        py::gil_scoped_release release;
+        _thread.join();
+      }
+      word_graph_type discard;
+      while (_queue.try_pop(discard)) {
+      }
+    }
+
+   private:
+    // Called from the worker threads; returns false if the search should
+    // stop.
+    bool push(word_graph_type const& wg) {
+      word_graph_type copy(wg);
+      size_t          spins = 0;
+      while (!_queue.try_push(copy)) {
+        if (_stop.load(std::memory_order_relaxed)) {
+          return false;
+        } else if (++spins < 64) {
+          std::this_thread::yield();
+        } else {
+          std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+      }
+      return !_stop.load(std::memory_order_relaxed);
+    }
+
+    BoundedQueue<word_graph_type> _queue;
+    std::atomic<bool>             _stop;
+    std::atomic<bool>             _done;
+    std::exception_ptr            _error;
+    std::thread                   _thread;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Writing word graphs to a file
+  //////////////////////////////////////////////////////////////////////////////
+
+  // The format of a file of word graphs is: the magic string and version; a
+  // header; and then fixed width records, one per word graph, each consisting
+  // of the number of nodes (uint32_t), and the targets of max_nodes nodes,
+  // padded with undefined targets, with every target stored in point_bytes
+  // bytes, and undefined targets stored as the maximum value that fits.
+  constexpr char     word_graphs_magic[5] = "LSWG";
+  constexpr uint32_t word_graphs_version  = 1;
+
+  struct WordGraphsHeader {
+    uint64_t out_degree;
+    uint64_t max_nodes;
+    uint64_t point_bytes;
+  };
+
+  namespace {
+    template <typename Point>
+    void pack_targets(word_graph_type const& wg,
+                      size_t                 max_nodes,
+                      std::vector<char>&     record) {
+      uint32_t nodes = wg.number_of_nodes();
+      std::memcpy(record.data(), &nodes, sizeof(nodes));
+      Point* out = reinterpret_cast<Point*>(record.data() + sizeof(nodes));
+      size_t i   = 0;
+      for (node_type s = 0; s < max_nodes; ++s) {
+        for (size_t a = 0; a < wg.out_degree(); ++a, ++i) {
+          node_type t = s < nodes ? wg.target_no_checks(s, a) : UNDEFINED;
+          Point     p = t == UNDEFINED ? std::numeric_limits<Point>::max()
+                                       : static_cast<Point>(t);
+          std::memcpy(out + i, &p, sizeof(Point));
+        }
+      }
+    }
+  }  // namespace
+
+  // Writes every word graph found by sims.for_each(n) to filename, from the
+  // threads in which they are found, and returns the number written.
+  template <typename Thing>
+  uint64_t write_word_graphs(Thing const&       sims,
+                             size_type          n,
+                             std::string const& filename,
+                             bool               compressed) {
+    size_t const out_degree = sims.presentation().alphabet().size();
+    // For semigroup presentations the word graphs have an extra node
+    size_t const max_nodes
+        = n + (sims.presentation().contains_empty_word() ? 0 : 1);
+    size_t point_bytes = sizeof(uint32_t);
+    if (compressed) {
+      point_bytes = max_nodes < std::numeric_limits<uint8_t>::max() ? 1
+                    : max_nodes < std::numeric_limits<uint16_t>::max() ? 2
+                                                                        : 4;
+    }
+    size_t const record_bytes
+        = sizeof(uint32_t) + max_nodes * out_degree * point_bytes;
+
+    BinaryWriter out(filename, word_graphs_magic, word_graphs_version);
+    out.write(WordGraphsHeader{out_degree, max_nodes, point_bytes});
+
+    std::mutex        mtx;
+    uint64_t          count    = 0;
+    std::atomic<bool> too_many = false;
+    try {
+      py::gil_scoped_release release;
+      TraceScope             trace("sims.write_word_graphs");
+      // find_if is used rather than for_each so that the search stops as soon
+      // as a word graph with too many nodes is found.
+      sims.find_if(n, [&](word_graph_type const& wg) {
+        if (too_many || wg.number_of_nodes() > max_nodes) {
+          too_many = true;
+          return true;
+        }
+        thread_local std::vector<char> record;
+        record.resize(record_bytes);
+        if (point_bytes == 1) {
+          pack_targets<uint8_t>(wg, max_nodes, record);
+        } else if (point_bytes == 2) {
+          pack_targets<uint16_t>(wg, max_nodes, record);
+        } else {
+          pack_targets<uint32_t>(wg, max_nodes, record);
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        out.write_bytes(record.data(), record.size());
+        ++count;
+        return false;
+      });
+      if (too_many) {
+        LIBSEMIGROUPS_EXCEPTION("found a word graph with more than {} nodes",
+                                max_nodes);
+      }
+      out.close();
+    } catch (...) {
+      // Do not leave a partially written file that looks valid.
+      out.close_no_checks();
+      std::remove(filename.c_str());
+      throw;
+    }
+    return count;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  // Parallel poset
+  //////////////////////////////////////////////////////////////////////////////
+
+  // Returns the covering relation of the congruences defined by the word
+  // graphs returned by sims.iterator(n), in compressed sparse row format, i.e.
+  // the congruences covering the i-th congruence are those with indices
+  // indices[indptr[i]], ..., indices[indptr[i + 1] - 1].
+  //
+  // The containments are found by sims.number_of_threads() threads, each with
+  // its own Joiner. Since a congruence strictly contained in another has more
+  // classes, only pairs with different numbers of nodes are compared. The
+  // strict containments are stored as one bitset per congruence, and so this
+  // uses N ^ 2 / 8 bytes for N congruences.
+  template <typename Thing>
+  std::pair<std::vector<uint64_t>, std::vector<uint32_t>>
+  poset_covers(Thing const& sims, size_type n) {
+    std::atomic<bool> stop = false;
+    return call_releasing_gil(
+        "sims.poset_sparse",
+        [&sims, n, &stop]() {
+          std::vector<word_graph_type> graphs;
+          for (auto it = sims.cbegin(n); it != sims.cend(n) && !stop; ++it) {
+            graphs.push_back(*it);
+          }
+          size_t const N     = graphs.size();
+          size_t const words = (N + 63) / 64;
+
+          // Call row(joiner, i) for every i in [0, N) in parallel
+          auto parallel = [&](auto&& row) {
+            std::atomic<size_t> next = 0;
+            auto                work = [&]() {
+              Joiner joiner;
+              for (size_t i = next++; i < N && !stop; i = next++) {
+                row(joiner, i);
+              }
+            };
+            size_t const threads = std::max(
+                size_t(1), std::min<size_t>(sims.number_of_threads(), N));
+            std::vector<std::thread> workers;
+            for (size_t t = 1; t < threads; ++t) {
+              workers.emplace_back(work);
+            }
+            work();
+            for (auto& w : workers) {
+              w.join();
+            }
+          };
+
+          auto is_set = [words](std::vector<uint64_t> const& bits,
+                                size_t                       i,
+                                size_t                       j) {
+            return (bits[i * words + j / 64] >> (j % 64)) & 1;
+          };
+
+          // up[i] is the set of j such that the i-th congruence is strictly
+          // contained in the j-th
+          std::vector<uint64_t> up(N * words, 0);
+          parallel([&](Joiner& joiner, size_t i) {
+            for (size_t j = 0; j < N; ++j) {
+              if (graphs[j].number_of_nodes() < graphs[i].number_of_nodes()
+                  && joiner.is_subrelation(graphs[i], graphs[j])) {
+                up[i * words + j / 64] |= uint64_t(1) << (j % 64);
+              }
+            }
+          });
+
+          // j covers i if j is in up[i] but not in up[k] for any k in up[i]
+          std::vector<std::vector<uint32_t>> covers(N);
+          parallel([&](Joiner&, size_t i) {
+            std::vector<uint64_t> cover(up.begin() + i * words,
+                                        up.begin() + (i + 1) * words);
+            for (size_t k = 0; k < N; ++k) {
+              if (is_set(up, i, k)) {
+                for (size_t w = 0; w < words; ++w) {
+                  cover[w] &= ~up[k * words + w];
+                }
+              }
+            }
+            for (size_t j = 0; j < N; ++j) {
+              if (is_set(cover, 0, j)) {
+                covers[i].push_back(j);
+              }
+            }
+          });
+
+          std::vector<uint64_t> indptr(N + 1, 0);
+          std::vector<uint32_t> indices;
+          for (size_t i = 0; i < N; ++i) {
+            indices.insert(indices.end(), covers[i].begin(), covers[i].end());
+            indptr[i + 1] = indices.size();
+          }
+          return std::make_pair(std::move(indptr), std::move(indices));
+        },
+        [&stop]() { stop = true; });
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   // SimsSettings
   //////////////////////////////////////////////////////////////////////////////
@@ -292,6 +1054,11 @@ by :py:meth:`~Sims1.pruners`.
 :only-document-once:
 Add a pruner to the search tree.
 
+Pruners implemented in C++, i.e. instances of :any:`SimsRefinerFaithful`,
+:any:`SimsRefinerIdeals`, or :any:`SimsPredicate`, are called without the GIL.
+Any other pruner is a Python function, and the GIL is acquired every time that
+it is called, which is much slower.
+
 :param pruner: a pruner function.
 :type pruner: collections.abc.Callable[[WordGraph], bool]
 
@@ -323,6 +1090,35 @@ Add a pruner to the search tree.
 :returns: The first argument *self*.
 :rtype: {0}
 
+.. warning::
+    When running the Sims low-index backtrack with multiple threads, each added
+    pruner must be guaranteed thread safe. Failing to do so could cause bad
+    things to happen.
+)pbdoc",
+                    doc_type)
+            .c_str());
+
+    // This overload must come before the next one, since SimsPredicate
+    // objects are also callable.
+    ss.def(
+        "add_pruner",
+        [](SimsSettings_& self, SimsPredicate const& pred) -> Subclass& {
+          pred.throw_if_letter_out_of_bounds(
+              self.presentation().alphabet().size());
+          return self.add_pruner(pred.checked_function());
+        },
+        py::arg("pruner"),
+        fmt::format(R"pbdoc(
+:sig=(self: {0}, pruner: collections.abc.Callable[[WordGraph], bool]) -> {0}:
+:only-document-once:
+Add a pruner to the search tree.
+
+:param pruner: a pruner function.
+:type pruner: collections.abc.Callable[[WordGraph], bool]
+
+:returns: The first argument *self*.
+:rtype: {0}
+
 .. warning::
     When running the Sims low-index backtrack with multiple threads, each added
     pruner must be guaranteed thread safe. Failing to do so could cause bad
@@ -633,6 +1429,9 @@ This function re-initializes a :any:`{0}` instance to be in the same state as
                        std::string_view              doc_type) {
     def_sims_reporc_common(thing, doc_type);
 
+    // The names of the functions below, as recorded by runner.start_tracing.
+    char const* trace_name;
+
     thing.def(py::init<Presentation<word_type> const&>(),
               py::arg("p"),
               fmt::format(R"pbdoc(
@@ -698,10 +1497,17 @@ constructed from the presentation *p*.
                     doc_type)
             .c_str());
 
-    thing.def("number_of_congruences",
-              &Thing::number_of_congruences,
-              py::arg("n"),
-              fmt::format(R"pbdoc(
+    trace_name
+        = intern_trace_name(fmt::format("{}.number_of_congruences", doc_type));
+    thing.def(
+        "number_of_congruences",
+        [trace_name](Thing const& self, size_type n) {
+          TraceScope trace(trace_name);
+          return self.number_of_congruences(n);
+        },
+        py::arg("n"),
+        py::call_guard<py::gil_scoped_release>(),
+        fmt::format(R"pbdoc(
 :sig=(self: {0}, n: int) -> int:
 
 Returns the number of one-sided congruences with up to a given number of
@@ -727,14 +1533,22 @@ This function exists to:
     if :py:meth:`~{0}.presentation()` has 0-generators and 0-relations (i.e.
     it has not been initialised).
 )pbdoc",
-                          doc_type)
-                  .c_str());
+                    doc_type)
+            .c_str());
 
-    thing.def("for_each",
-              &Thing::for_each,
-              py::arg("n"),
-              py::arg("pred"),
-              fmt::format(R"pbdoc(
+    trace_name = intern_trace_name(fmt::format("{}.for_each", doc_type));
+    thing.def(
+        "for_each",
+        [trace_name](Thing const&                                       self,
+                     size_type                                          n,
+                     std::function<void(word_graph_type const&)> const& pred) {
+          TraceScope trace(trace_name);
+          self.for_each(n, pred);
+        },
+        py::arg("n"),
+        py::arg("pred"),
+        py::call_guard<py::gil_scoped_release>(),
+        fmt::format(R"pbdoc(
 :sig=(self: {0}, n: int, pred: collections.abc.Callable[[WordGraph], None]) -> None:
 
 Apply a unary predicate to every one-sided congruence with at most a given
@@ -762,15 +1576,27 @@ most *n* classes. This function exists to:
 
 .. seealso::  :py:meth:`~{0}.iterator`, :py:meth:`~{0}.find_if`
 )pbdoc",
-                          doc_type)
-                  .c_str());
+                    doc_type)
+            .c_str());
 
-    thing.def("find_if",
-              &Thing::find_if,
-              py::arg("n"),
-              py::arg("pred"),
-              fmt::format(R"pbdoc(
+    // This overload must come before the next one, since SimsPredicate
+    // objects are also callable.
+    trace_name = intern_trace_name(fmt::format("{}.find_if", doc_type));
+    thing.def(
+        "find_if",
+        [trace_name](
+            Thing const& self, size_type n, SimsPredicate const& pred) {
+          pred.throw_if_letter_out_of_bounds(
+              self.presentation().alphabet().size());
+          py::gil_scoped_release release;
+          TraceScope             trace(trace_name);
+          return self.find_if(n, pred.checked_function());
+        },
+        py::arg("n"),
+        py::arg("pred"),
+        fmt::format(R"pbdoc(
 :sig=(self: {0}, n: int, pred: collections.abc.Callable[[WordGraph], bool]) -> WordGraph:
+:only-document-once:
 
 Apply a unary predicate to one-sided congruences with at most a given number of
 classes, until it returns ``True``.
@@ -784,6 +1610,10 @@ exists to:
 * allow for searching for a congruence satisfying certain conditions using
   :py:meth:`~{0}.number_of_threads` in parallel.
 
+If *pred* is a :any:`SimsPredicate`, then it is called without the GIL, and so
+the threads do not have to wait for each other. Otherwise, the GIL is acquired
+every time *pred* is called.
+
 :param n: the maximum number of congruence classes.
 :type n: int
 
@@ -803,8 +1633,125 @@ exists to:
 
 .. seealso::  :py:meth:`~{0}.iterator`, :py:meth:`~{0}.for_each`
 )pbdoc",
-                          doc_type)
-                  .c_str());
+                    doc_type)
+            .c_str());
+
+    trace_name = intern_trace_name(fmt::format("{}.find_if", doc_type));
+    thing.def(
+        "find_if",
+        [trace_name](Thing const&                                       self,
+                     size_type                                          n,
+                     std::function<bool(word_graph_type const&)> const& pred) {
+          TraceScope trace(trace_name);
+          return self.find_if(n, pred);
+        },
+        py::arg("n"),
+        py::arg("pred"),
+        py::call_guard<py::gil_scoped_release>(),
+        fmt::format(R"pbdoc(
+:sig=(self: {0}, n: int, pred: collections.abc.Callable[[WordGraph], bool]) -> WordGraph:
+:only-document-once:
+
+Apply a unary predicate to one-sided congruences with at most a given number of
+classes, until it returns ``True``.
+
+This function applies the predicate *pred* to every congruence with at most *n*
+classes, until a congruence satisfying the predicate is found. This function
+exists to:
+
+* provide some feedback on the progress of the computation if it runs for more
+  than 1 second.
+* allow for searching for a congruence satisfying certain conditions using
+  :py:meth:`~{0}.number_of_threads` in parallel.
+
+If *pred* is a :any:`SimsPredicate`, then it is called without the GIL, and so
+the threads do not have to wait for each other. Otherwise, the GIL is acquired
+every time *pred* is called.
+
+:param n: the maximum number of congruence classes.
+:type n: int
+
+:param pred: the predicate applied to every congruence found.
+:type pred: collections.abc.Callable[[WordGraph], bool]
+
+:returns:
+    The first :any:`WordGraph` for which *pred* returns ``True``, or the empty
+    word graph if no such word graph exists.
+:rtype: WordGraph
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+:raises LibsemigroupsError:
+    if :py:meth:`~{0}.presentation()` has 0-generators and 0-relations (i.e.
+    it has not been initialised).
+
+.. seealso::  :py:meth:`~{0}.iterator`, :py:meth:`~{0}.for_each`
+)pbdoc",
+                    doc_type)
+            .c_str());
+
+    trace_name
+        = intern_trace_name(fmt::format("{}.parallel_iterator", doc_type));
+    thing.def(
+        "parallel_iterator",
+        [trace_name](Thing const& self, size_type n, size_t capacity) {
+          return std::make_unique<SimsResultQueue>(
+              self, trace_name, n, capacity);
+        },
+        py::arg("n"),
+        py::arg("capacity") = 1024,
+        fmt::format(R"pbdoc(
+:sig=(self: {0}, n: int, capacity: int = 1024) -> SimsResultQueue:
+
+Returns an iterator yielding all congruences of index at most *n* that are
+found in parallel.
+
+This function returns a :any:`SimsResultQueue` yielding the same
+:any:`WordGraph` objects as :py:meth:`~{0}.iterator`, but that are found by
+:py:meth:`~{0}.number_of_threads` threads, which run in the background with the
+GIL released. The threads push the word graphs they find into a queue with
+space for at least *capacity* word graphs, and the returned iterator pops them
+from the queue. Unlike :py:meth:`~{0}.for_each` and :py:meth:`~{0}.find_if`,
+no Python code is called from the threads, and so the search is not slowed
+down by the threads waiting for the GIL, however much work is done in Python
+with each word graph. If the queue is full, then the threads wait until the
+iterator is advanced.
+
+The order in which the word graphs are yielded is not deterministic. The
+settings of this object are copied when this function is called, and so
+changing them afterwards does not affect the returned iterator.
+
+:param n: the maximum number of classes in a congruence.
+:type n: int
+
+:param capacity: the minimum capacity of the queue (default: ``1024``).
+:type capacity: int
+
+:returns: An iterator yielding :any:`WordGraph` objects.
+:rtype: SimsResultQueue
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+:raises LibsemigroupsError: if *capacity* is ``0``.
+
+:raises LibsemigroupsError:
+    if :py:meth:`~{0}.presentation()` has 0-generators and 0-relations (i.e.
+    it has not been initialised).
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import {0}, Presentation, presentation
+    >>> p = Presentation([0, 1])
+    >>> presentation.add_rule(p, [0, 1], [1, 0])
+    >>> sims = {0}(p).number_of_threads(2)
+    >>> results = list(sims.parallel_iterator(3))
+    >>> len(results) == sims.number_of_congruences(3)
+    True
+
+.. seealso::  :py:meth:`~{0}.iterator`, :py:meth:`~{0}.for_each`
+)pbdoc",
+                    doc_type)
+            .c_str());
 
     thing.def(
         "iterator",
@@ -1440,9 +2387,13 @@ are seeking.
 
     // The next function returns by value, so no
     // return_value_policy required here.
-    ro.def("word_graph",
-           &RepOrc::word_graph,
-           R"pbdoc(
+    ro.def(
+        "word_graph",
+        [](RepOrc& self) {
+          TraceScope trace("RepOrc.word_graph");
+          return self.word_graph();
+        },
+        R"pbdoc(
 Get the word graph.
 
 This function attempts to find a right congruence, represented as an
@@ -1490,9 +2441,13 @@ returned (with ``0`` nodes and ``0`` edges).
 
     // The next function returns by value, so no
     // return_value_policy required here.
-    mro.def("word_graph",
-            &MinimalRepOrc::word_graph,
-            R"pbdoc(
+    mro.def(
+        "word_graph",
+        [](MinimalRepOrc& self) {
+          TraceScope trace("MinimalRepOrc.word_graph");
+          return self.word_graph();
+        },
+        R"pbdoc(
 Get the word graph.
 
 This function attempts to find a right congruence, represented as an
@@ -1521,6 +2476,476 @@ is returned (if any).
 
 :returns: A value of type :any:`WordGraph`.
 :rtype: WordGraph
+)pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////////
+    // SimsPredicate
+    ////////////////////////////////////////////////////////////////////////////
+
+    py::class_<SimsPredicate> sp(m,
+                                 "SimsPredicate",
+                                 R"pbdoc(
+A predicate on word graphs implemented in C++.
+
+Instances of this class are returned by the functions :any:`sims.max_nodes`,
+:any:`sims.compatible_with`, :any:`sims.not_identified`,
+:any:`sims.faithful_on`, and :any:`sims.strictly_cyclic`, and can be combined
+using the operators ``&`` (and), ``|`` (or), and ``~`` (not). They can be used
+as pruners in :py:meth:`Sims1.add_pruner`, or as predicates in
+:py:meth:`Sims1.find_if` (and the analogous functions of :any:`Sims2`), and
+since they are implemented entirely in C++, they are called without the GIL,
+and so do not prevent the threads of a search from running in parallel.
+
+A pruner must return ``False`` only for word graphs that cannot be extended to
+a word graph that it accepts. Each of the functions above returns a predicate
+with this property, as do ``&`` and ``|``, but ``~`` does not in general.
+
+A predicate that contains a letter that is not less than the out-degree of a
+word graph cannot be applied to it. Calling the predicate on such a word graph
+raises an exception, and so does adding it to a search whose presentation has
+too few letters. If the presentation of a search is replaced after the
+predicate is added, then the predicate returns ``False`` for every word graph
+with too few letters. If it is used as a pruner, the search then finds no
+word graphs.
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import Sims1, Presentation, presentation, sims
+    >>> p = Presentation([0, 1])
+    >>> presentation.add_rule(p, [0, 1], [1, 0])
+    >>> pred = sims.not_identified([0], [1]) & sims.compatible_with([[0, 0], [0]])
+    >>> pred
+    <SimsPredicate (not_identified([0], [1]) & compatible_with(1 rules))>
+    >>> s = Sims1(p).add_pruner(pred)
+    >>> all(pred(wg) for wg in s.iterator(4))
+    True
+)pbdoc");
+
+    sp.def("__repr__", [](SimsPredicate const& self) {
+      return fmt::format("<SimsPredicate {}>", self.expr());
+    });
+    sp.def(
+        "__call__",
+        [](SimsPredicate const& self, word_graph_type const& wg) {
+          self.throw_if_letter_out_of_bounds(wg.out_degree());
+          return self(wg);
+        },
+        py::arg("wg"),
+        R"pbdoc(
+:sig=(self: SimsPredicate, wg: WordGraph) -> bool:
+
+Apply the predicate to a word graph.
+
+:param wg: the word graph.
+:type wg: WordGraph
+
+:returns: Whether or not *wg* satisfies the predicate.
+:rtype: bool
+
+:raises LibsemigroupsError:
+  if any word used by the predicate contains a letter that is not less than
+  :any:`WordGraph.out_degree`.
+)pbdoc");
+    sp.def("__and__", [](SimsPredicate const& x, SimsPredicate const& y) {
+      return SimsPredicate(
+          [f = x.function(), g = y.function()](word_graph_type const& wg) {
+            return f(wg) && g(wg);
+          },
+          fmt::format("({} & {})", x.expr(), y.expr()),
+          std::max(x.letters(), y.letters()));
+    });
+    sp.def("__or__", [](SimsPredicate const& x, SimsPredicate const& y) {
+      return SimsPredicate(
+          [f = x.function(), g = y.function()](word_graph_type const& wg) {
+            return f(wg) || g(wg);
+          },
+          fmt::format("({} | {})", x.expr(), y.expr()),
+          std::max(x.letters(), y.letters()));
+    });
+    sp.def("__invert__", [](SimsPredicate const& x) {
+      return SimsPredicate(
+          [f = x.function()](word_graph_type const& wg) { return !f(wg); },
+          fmt::format("~{}", x.expr()),
+          x.letters());
+    });
+
+    py::class_<SimsThreadStats> sts(m,
+                                    "SimsThreadStats",
+                                    R"pbdoc(
+Per-thread statistics of the search conducted by a :any:`Sims1` or
+:any:`Sims2` object.
+
+The values in a :any:`SimsStats` object are totals over all of the threads of a
+search. Instances of this class instead record, separately for every thread
+in which the search runs, the number of nodes of the search tree visited, the
+time that the thread was idle, and the depth of the search, and so can be used
+to check whether or not all of the threads are kept busy.
+
+The statistics are recorded by the :any:`SimsPredicate` returned by
+:any:`SimsThreadStats.pruner`, which accepts every word graph, and which must
+be added to the search using :py:meth:`Sims1.add_pruner`. Recording the
+statistics never locks, and they can be read, for example from another Python
+thread, while the search is running.
+
+The threads of a search in ``libsemigroups`` are not directly observable, and
+so the idle time and the number of idle periods are approximations: a thread
+is considered to be idle whenever more than :any:`SimsThreadStats.idle_threshold`
+elapses between two consecutive nodes being visited in that thread. A thread
+that becomes idle resumes when it obtains more work from another thread, and
+so the number of idle periods of a thread approximates the number of times
+that it successfully obtained work from another thread.
+
+.. doctest::
+
+    >>> from libsemigroups_pybind11 import Sims1, Presentation, presentation, SimsThreadStats
+    >>> p = Presentation([0, 1])
+    >>> presentation.add_rule(p, [0, 1], [1, 0])
+    >>> stats = SimsThreadStats()
+    >>> s = Sims1(p).number_of_threads(2).add_pruner(stats.pruner())
+    >>> s.number_of_congruences(4)
+    117
+    >>> 1 <= stats.number_of_threads() <= 2
+    True
+)pbdoc");
+    sts.def(py::init([](size_t max_threads, std::chrono::nanoseconds idle) {
+              return SimsThreadStats(max_threads, idle);
+            }),
+            py::arg("max_threads")    = 64,
+            py::arg("idle_threshold") = std::chrono::milliseconds(1),
+            R"pbdoc(
+:sig=(self: SimsThreadStats, max_threads: int = 64, idle_threshold: datetime.timedelta = datetime.timedelta(milliseconds=1)) -> None:
+
+Construct a :any:`SimsThreadStats` object.
+
+:param max_threads:
+  the maximum number of threads whose statistics are recorded separately; the
+  statistics of any further threads are added to those of the last thread
+  (default: ``64``).
+:type max_threads: int
+
+:param idle_threshold:
+  the minimum time between two consecutive nodes being visited in a thread for
+  that thread to be considered idle (default: 1 millisecond).
+:type idle_threshold: datetime.timedelta
+
+:raises LibsemigroupsError: if *max_threads* is ``0``.
+)pbdoc");
+    sts.def("__repr__", [](SimsThreadStats const& self) {
+      auto nodes = self.collect([](auto const& s) { return s.nodes.load(); });
+      return fmt::format("<SimsThreadStats with {} threads and {} nodes>",
+                         self.number_of_threads(),
+                         std::accumulate(nodes.cbegin(), nodes.cend(), 0ULL));
+    });
+    sts.def("pruner",
+            &SimsThreadStats::pruner,
+            R"pbdoc(
+:sig=(self: SimsThreadStats) -> SimsPredicate:
+
+Returns the pruner that records the statistics.
+
+This function returns a :any:`SimsPredicate` that accepts every word graph,
+and that records the statistics of the thread in which it is called in this
+object. It should be added to a :any:`Sims1` or :any:`Sims2` object using
+:py:meth:`Sims1.add_pruner`. Since it is implemented in C++, it can be called
+without the GIL, and it can be combined with other predicates using ``&``.
+Recording the statistics for a single node costs one call to
+``steady_clock::now()`` and a few atomic operations, except that the depth is
+only computed once in every 64 calls in each thread.
+
+:returns: The pruner.
+:rtype: SimsPredicate
+)pbdoc");
+    sts.def("number_of_threads",
+            &SimsThreadStats::number_of_threads,
+            R"pbdoc(
+:sig=(self: SimsThreadStats) -> int:
+
+Returns the number of threads whose statistics have been recorded.
+
+The threads are numbered in the order in which they first called the pruner
+returned by :any:`SimsThreadStats.pruner`, and every list returned by the
+other functions of this class has one entry per thread in this order. The
+returned value is at most the value of *max_threads* used to construct this
+object.
+
+:returns: The number of threads.
+:rtype: int
+)pbdoc");
+    sts.def(
+        "nodes",
+        [](SimsThreadStats const& self) {
+          return self.collect([](auto const& s) { return s.nodes.load(); });
+        },
+        R"pbdoc(
+:sig=(self: SimsThreadStats) -> list[int]:
+
+Returns the number of nodes of the search tree visited by each thread.
+
+:returns: The numbers of nodes visited.
+:rtype: list[int]
+)pbdoc");
+    sts.def(
+        "idle_time",
+        [](SimsThreadStats const& self) {
+          std::vector<std::chrono::nanoseconds> result;
+          for (auto ns : self.collect(
+                   [](auto const& s) { return s.idle_ns.load(); })) {
+            result.emplace_back(ns);
+          }
+          return result;
+        },
+        R"pbdoc(
+:sig=(self: SimsThreadStats) -> list[datetime.timedelta]:
+
+Returns the approximate time that each thread was idle.
+
+:returns: The total idle time of each thread.
+:rtype: list[datetime.timedelta]
+)pbdoc");
+    sts.def(
+        "idle_periods",
+        [](SimsThreadStats const& self) {
+          return self.collect(
+              [](auto const& s) { return s.idle_periods.load(); });
+        },
+        R"pbdoc(
+:sig=(self: SimsThreadStats) -> list[int]:
+
+Returns the number of times that each thread resumed after being idle.
+
+This is an approximation of the number of times that each thread obtained
+work from another thread.
+
+:returns: The numbers of idle periods.
+:rtype: list[int]
+)pbdoc");
+    sts.def(
+        "depth",
+        [](SimsThreadStats const& self) {
+          return self.collect([](auto const& s) { return s.depth.load(); });
+        },
+        R"pbdoc(
+:sig=(self: SimsThreadStats) -> list[int]:
+
+Returns the current depth of the search in each thread.
+
+The depth of the search in a thread is the number of nodes defined in the
+word graph at the node of the search tree most recently visited by the
+thread, which is sampled once every 64 nodes visited.
+
+:returns: The current depth of each thread.
+:rtype: list[int]
+)pbdoc");
+    sts.def(
+        "max_depth",
+        [](SimsThreadStats const& self) {
+          return self.collect(
+              [](auto const& s) { return s.max_depth.load(); });
+        },
+        R"pbdoc(
+:sig=(self: SimsThreadStats) -> list[int]:
+
+Returns the maximum sampled depth of the search in each thread.
+
+:returns: The maximum depth of each thread.
+:rtype: list[int]
+
+.. seealso:: :any:`SimsThreadStats.depth`.
+)pbdoc");
+    sts.def("idle_threshold",
+            &SimsThreadStats::idle_threshold,
+            R"pbdoc(
+:sig=(self: SimsThreadStats) -> datetime.timedelta:
+
+Returns the idle threshold.
+
+:returns: The value of *idle_threshold* used to construct this object.
+:rtype: datetime.timedelta
+)pbdoc");
+    sts.def("max_threads",
+            &SimsThreadStats::max_threads,
+            R"pbdoc(
+:sig=(self: SimsThreadStats) -> int:
+
+Returns the maximum number of threads.
+
+:returns: The value of *max_threads* used to construct this object.
+:rtype: int
+)pbdoc");
+    sts.def("reset",
+            &SimsThreadStats::reset,
+            R"pbdoc(
+:sig=(self: SimsThreadStats) -> None:
+
+Reset the statistics.
+
+This function forgets all threads, and sets all statistics to ``0``. Since
+the threads of a search are created every time that a search is run, this
+function should usually be called before running another search, so that the
+statistics of the threads of the previous search are not reported.
+)pbdoc");
+
+    m.def("sims_max_nodes",
+          &max_nodes,
+          py::arg("n"),
+          R"pbdoc(
+:sig=(n: int) -> SimsPredicate:
+
+Returns a predicate that bounds the number of nodes.
+
+This function returns a :any:`SimsPredicate` that accepts a word graph if and
+only if at most *n* nodes are reachable from the node ``0``. These are the
+nodes that have been defined so far in a word graph in the search tree of
+:any:`Sims1` or :any:`Sims2`.
+
+:param n: the maximum number of nodes.
+:type n: int
+
+:returns: The predicate.
+:rtype: SimsPredicate
+)pbdoc");
+    m.def("sims_compatible_with",
+          &compatible_with,
+          py::arg("rules"),
+          R"pbdoc(
+:sig=(rules: list[list[int]]) -> SimsPredicate:
+
+Returns a predicate that checks compatibility with some relations.
+
+This function returns a :any:`SimsPredicate` that accepts a word graph if and
+only if, for every node ``s`` and every relation ``(u, v)`` in *rules*, the
+paths from ``s`` labelled by ``u`` and ``v`` either lead to the same node, or
+at least one of them is not defined. For complete word graphs, this is the
+same as the word graph being compatible with *rules*.
+
+:param rules:
+    a list of words such that ``(rules[2*i], rules[2*i+1])`` is the ``i``-th
+    relation.
+:type rules: list[list[int]]
+
+:returns: The predicate.
+:rtype: SimsPredicate
+
+:raises LibsemigroupsError: if *rules* has odd length.
+)pbdoc");
+    m.def("sims_not_identified",
+          &not_identified,
+          py::arg("u"),
+          py::arg("v"),
+          R"pbdoc(
+:sig=(u: list[int], v: list[int]) -> SimsPredicate:
+
+Returns a predicate that checks that a pair of words is not identified.
+
+This function returns a :any:`SimsPredicate` that accepts a word graph unless
+the paths from the node ``0`` labelled by *u* and *v* are both defined and lead
+to the same node. For a word graph yielded by :any:`Sims1` or :any:`Sims2`,
+this means that the pair (*u*, *v*) does not belong to the corresponding
+congruence.
+
+:param u: the first word.
+:type u: list[int]
+
+:param v: the second word.
+:type v: list[int]
+
+:returns: The predicate.
+:rtype: SimsPredicate
+)pbdoc");
+    m.def("sims_faithful_on",
+          &faithful_on,
+          py::arg("words"),
+          R"pbdoc(
+:sig=(words: list[list[int]]) -> SimsPredicate:
+
+Returns a predicate that checks that the action is faithful on some words.
+
+This function returns a :any:`SimsPredicate` that accepts a word graph unless
+it is complete on the nodes reachable from the node ``0``, and there are two
+distinct words in *words* that label paths leading to the same node from every
+such node. In other words, the predicate rejects those complete word graphs
+on which the action of some pair of words in *words* is the same. Word graphs
+that are not complete are always accepted.
+
+:param words: the words.
+:type words: list[list[int]]
+
+:returns: The predicate.
+:rtype: SimsPredicate
+)pbdoc");
+    m.def("sims_strictly_cyclic",
+          &strictly_cyclic,
+          R"pbdoc(
+:sig=() -> SimsPredicate:
+
+Returns a predicate that checks if a word graph is strictly cyclic.
+
+This function returns a :any:`SimsPredicate` that accepts a word graph unless
+it is complete on the nodes reachable from the node ``0``, and the subgraph
+induced on these nodes is not strictly cyclic (see
+:any:`word_graph.is_strictly_cyclic`). Word graphs that are not complete are
+always accepted.
+
+:returns: The predicate.
+:rtype: SimsPredicate
+)pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////////
+    // SimsResultQueue
+    ////////////////////////////////////////////////////////////////////////////
+
+    py::class_<SimsResultQueue> srq(m,
+                                    "SimsResultQueue",
+                                    R"pbdoc(
+An iterator yielding the congruences found by a parallel search.
+
+Instances of this class are returned by :py:meth:`Sims1.parallel_iterator` and
+:py:meth:`Sims2.parallel_iterator`, and yield the :any:`WordGraph` objects found
+by a search that runs in the background in :py:meth:`~Sims1.number_of_threads`
+threads. Advancing the iterator releases the GIL while waiting for the next word
+graph to be found, and can be interrupted using Ctrl-C.
+
+If the iterator is not exhausted, then the search continues in the background
+until the queue is full. :any:`SimsResultQueue.close` can be used to stop the
+search early.
+)pbdoc");
+
+    srq.def("__iter__", [](py::object self) { return self; });
+    srq.def("__next__", [](SimsResultQueue& self) {
+      auto result = self.next();
+      if (!result) {
+        throw py::stop_iteration();
+      }
+      return std::move(*result);
+    });
+    srq.def("capacity",
+            &SimsResultQueue::capacity,
+            R"pbdoc(
+:sig=(self: SimsResultQueue) -> int:
+
+Returns the capacity of the queue.
+
+This function returns the maximum number of word graphs that can be found, but
+not yet yielded, at any time. This is the *capacity* argument of
+:py:meth:`Sims1.parallel_iterator` rounded up to a power of 2.
+
+:returns: The capacity of the queue.
+:rtype: int
+)pbdoc");
+    srq.def("close",
+            &SimsResultQueue::close,
+            R"pbdoc(
+:sig=(self: SimsResultQueue) -> None:
+
+Stop the search.
+
+This function stops the search, waits for the background threads to stop, and
+discards any word graphs that have been found but not yet yielded. The
+background threads stop at the next node of the search tree that they visit,
+rather than when the next congruence is found, and so this function returns
+promptly. After this function is called, the iterator is exhausted. This
+function is called automatically when a :any:`SimsResultQueue` is garbage
+collected.
 )pbdoc");
 
     ////////////////////////////////////////////////////////////////////////////
@@ -1826,6 +3251,110 @@ the semigroup or monoid defined by *p* and ``False`` otherwise.
 :rtype: bool
 )pbdoc");
 
+    m.def("sims_write_word_graphs",
+          &write_word_graphs<Sims1>,
+          py::arg("sims"),
+          py::arg("n"),
+          py::arg("filename"),
+          py::arg("compressed") = false,
+          fmt::format(R"pbdoc(
+:sig=(sims: {0}, n: int, filename: str, compressed: bool = False) -> int:
+:only-document-once:
+
+Write the word graphs of the congruences with at most *n* classes to a file.
+
+This function writes every :any:`WordGraph` yielded by ``sims.iterator(n)``
+to the file *filename*, and returns the number written. The word graphs are
+found using :py:meth:`~Sims1.number_of_threads` threads, and are written
+directly from these threads, with the GIL released, and without creating any
+Python objects, so the memory used does not depend on the number of word
+graphs found. The order of the word graphs in the file is not deterministic.
+
+Every word graph is stored in a fixed width record, and so the file can be
+read efficiently, using a memory map, by :any:`sims.WordGraphReader`. If
+*compressed* is ``True``, then the targets are stored using the smallest of 1,
+2, or 4 bytes that can represent every node, rather than always using 4 bytes.
+This is the only compression used: the records are not compressed by any
+general purpose algorithm, so that the file can still be memory mapped without
+being decompressed.
+
+If a word graph with more than *n* nodes (or *n* + 1 nodes if the presentation
+does not contain the empty word) is found, then the search is stopped, the file
+*filename* is deleted, and an exception is raised.
+
+:param sims: the object whose congruences are written.
+:type sims: {0}
+
+:param n: the maximum number of classes in a congruence.
+:type n: int
+
+:param filename: the name of the file.
+:type filename: str
+
+:param compressed:
+  whether or not to store targets using fewer bytes (default: ``False``).
+:type compressed: bool
+
+:returns: The number of word graphs written.
+:rtype: int
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+:raises LibsemigroupsError: if the file cannot be written.
+)pbdoc", "Sims1").c_str());
+
+    m.def("sims_write_word_graphs",
+          &write_word_graphs<Sims2>,
+          py::arg("sims"),
+          py::arg("n"),
+          py::arg("filename"),
+          py::arg("compressed") = false,
+          fmt::format(R"pbdoc(
+:sig=(sims: {0}, n: int, filename: str, compressed: bool = False) -> int:
+:only-document-once:
+
+Write the word graphs of the congruences with at most *n* classes to a file.
+
+This function writes every :any:`WordGraph` yielded by ``sims.iterator(n)``
+to the file *filename*, and returns the number written. The word graphs are
+found using :py:meth:`~Sims1.number_of_threads` threads, and are written
+directly from these threads, with the GIL released, and without creating any
+Python objects, so the memory used does not depend on the number of word
+graphs found. The order of the word graphs in the file is not deterministic.
+
+Every word graph is stored in a fixed width record, and so the file can be
+read efficiently, using a memory map, by :any:`sims.WordGraphReader`. If
+*compressed* is ``True``, then the targets are stored using the smallest of 1,
+2, or 4 bytes that can represent every node, rather than always using 4 bytes.
+This is the only compression used: the records are not compressed by any
+general purpose algorithm, so that the file can still be memory mapped without
+being decompressed.
+
+If a word graph with more than *n* nodes (or *n* + 1 nodes if the presentation
+does not contain the empty word) is found, then the search is stopped, the file
+*filename* is deleted, and an exception is raised.
+
+:param sims: the object whose congruences are written.
+:type sims: {0}
+
+:param n: the maximum number of classes in a congruence.
+:type n: int
+
+:param filename: the name of the file.
+:type filename: str
+
+:param compressed:
+  whether or not to store targets using fewer bytes (default: ``False``).
+:type compressed: bool
+
+:returns: The number of word graphs written.
+:rtype: int
+
+:raises LibsemigroupsError: if *n* is ``0``.
+
+:raises LibsemigroupsError: if the file cannot be written.
+)pbdoc", "Sims2").c_str());
+
     m.def(
         "sims_poset",
         [](Sims1& sims, size_t n) {
@@ -1889,6 +3418,102 @@ computing the two-sided congruence lattice of the semigroup or monoid.
 :returns: A boolean matrix defining the congruence poset.
 :rtype: Matrix
 )pbdoc");
+
+    m.def(
+        "sims_poset_sparse",
+        [](Sims1 const& sims, size_t n) {
+          auto [indptr, indices] = poset_covers(sims, n);
+          return py::make_tuple(
+              py::array_t<uint64_t>(indptr.size(), indptr.data()),
+              py::array_t<uint32_t>(indices.size(), indices.data()));
+        },
+        py::arg("sims"),
+        py::arg("n"),
+        fmt::format(R"pbdoc(
+:sig=(sims: {0}, n: int) -> tuple[numpy.ndarray, numpy.ndarray]:
+:only-document-once:
+
+Compute the inclusion poset of a collection of congruences returned by a
+:any:`{0}` object with at most *n* classes, in parallel, as a sparse matrix.
+
+This function returns the same relation as :any:`sims.poset`, but in
+compressed sparse row format, and so it can be used for much larger numbers of
+congruences. More precisely, this function returns a pair ``(indptr,
+indices)`` of NumPy arrays such that the :math:`i`-th word graph returned by
+:any:`{0}.iterator` with input *n* defines a congruence that is covered by the
+congruence defined by the :math:`j`-th word graph if and only if :math:`j` is
+one of ``indices[indptr[i]:indptr[i + 1]]``, which are sorted in increasing
+order. The arrays can be passed directly to ``scipy.sparse.csr_array((data,
+indices, indptr))``, where ``data`` is an array of ones of the same length as
+``indices``.
+
+The pairs of congruences are compared using :py:meth:`~{0}.number_of_threads`
+threads, with the GIL released. Since a congruence strictly contained in
+another has more classes, pairs of word graphs with the same number of nodes
+are never compared. This function uses approximately :math:`N ^ 2 / 8` bytes
+of memory, where :math:`N` is the number of congruences.
+
+:param sims: the object whose congruences are compared.
+:type sims: {0}
+
+:param n: the maximum number of congruence classes.
+:type n: int
+
+:returns: The pair of arrays ``(indptr, indices)``.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError: if *n* is ``0``.
+)pbdoc",
+                    "Sims1")
+            .c_str());
+
+    m.def(
+        "sims_poset_sparse",
+        [](Sims2 const& sims, size_t n) {
+          auto [indptr, indices] = poset_covers(sims, n);
+          return py::make_tuple(
+              py::array_t<uint64_t>(indptr.size(), indptr.data()),
+              py::array_t<uint32_t>(indices.size(), indices.data()));
+        },
+        py::arg("sims"),
+        py::arg("n"),
+        fmt::format(R"pbdoc(
+:sig=(sims: {0}, n: int) -> tuple[numpy.ndarray, numpy.ndarray]:
+:only-document-once:
+
+Compute the inclusion poset of a collection of congruences returned by a
+:any:`{0}` object with at most *n* classes, in parallel, as a sparse matrix.
+
+This function returns the same relation as :any:`sims.poset`, but in
+compressed sparse row format, and so it can be used for much larger numbers of
+congruences. More precisely, this function returns a pair ``(indptr,
+indices)`` of NumPy arrays such that the :math:`i`-th word graph returned by
+:any:`{0}.iterator` with input *n* defines a congruence that is covered by the
+congruence defined by the :math:`j`-th word graph if and only if :math:`j` is
+one of ``indices[indptr[i]:indptr[i + 1]]``, which are sorted in increasing
+order. The arrays can be passed directly to ``scipy.sparse.csr_array((data,
+indices, indptr))``, where ``data`` is an array of ones of the same length as
+``indices``.
+
+The pairs of congruences are compared using :py:meth:`~{0}.number_of_threads`
+threads, with the GIL released. Since a congruence strictly contained in
+another has more classes, pairs of word graphs with the same number of nodes
+are never compared. This function uses approximately :math:`N ^ 2 / 8` bytes
+of memory, where :math:`N` is the number of congruences.
+
+:param sims: the object whose congruences are compared.
+:type sims: {0}
+
+:param n: the maximum number of congruence classes.
+:type n: int
+
+:returns: The pair of arrays ``(indptr, indices)``.
+:rtype: tuple[numpy.ndarray, numpy.ndarray]
+
+:raises LibsemigroupsError: if *n* is ``0``.
+)pbdoc",
+                    "Sims2")
+            .c_str());
   }  // init_sims
 
 }  // namespace libsemigroups
@@ -0,0 +1,59 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_STATIC_PTRANSF_HPP_
+#define SRC_STATIC_PTRANSF_HPP_
+
+// C++ stl headers....
+#include <cstddef>      // for size_t
+#include <string>       // for string, to_string
+#include <type_traits>  // for integral_constant
+#include <utility>      // for index_sequence
+
+namespace libsemigroups {
+
+  // The degrees of the transformations, partial perms, and permutations whose
+  // degree is a template parameter, and so whose images are stored inline
+  // rather than in a vector, that are bound in addition to those whose degree
+  // is only known at run time. The Python classes Transf, PPerm, and Perm use
+  // these types for every such degree, and so this must be kept in sync with
+  // STATIC_PTRANSF_DEGREES, see init_transf.
+  using static_ptransf_degrees = std::
+      index_sequence<2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 32>;
+
+  template <typename Func, size_t... N>
+  void for_each_static_ptransf_degree(Func&& func, std::index_sequence<N...>) {
+    (func(std::integral_constant<size_t, N>()), ...);
+  }
+
+  // Calls func(std::integral_constant<size_t, N>()) for every N in
+  // static_ptransf_degrees.
+  template <typename Func>
+  void for_each_static_ptransf_degree(Func&& func) {
+    for_each_static_ptransf_degree(std::forward<Func>(func),
+                                   static_ptransf_degrees());
+  }
+
+  // Returns the name of the bound type with the given prefix (such as
+  // "Transf") and static degree N, for example "StaticTransf5".
+  inline std::string static_ptransf_name(char const* prefix, size_t N) {
+    return std::string("Static") + prefix + std::to_string(N);
+  }
+}  // namespace libsemigroups
+
+#endif  // SRC_STATIC_PTRANSF_HPP_
@@ -33,6 +33,10 @@
 // libsemigroups_pybind11....
 #include "cong-common.hpp"  // for contains
 #include "main.hpp"         // for init_detail_todd_coxeter_impl
+#include "memory.hpp"       // for def_memory_usage
+#include "metrics.hpp"      // for record_metrics, MetricsStream
+#include "runner.hpp"       // for StopCondition
+#include "trace.hpp"        // for TraceScope
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -263,14 +267,29 @@ The valid values are:
     def_add_generating_pair(thing, "ToddCoxeterImpl_");
     def_currently_contains(thing, "ToddCoxeterImpl_");
     def_contains(thing, "ToddCoxeterImpl_");
+    def_contains_many(thing, "ToddCoxeterImpl_");
     def_reduce_no_run(thing, "ToddCoxeterImpl_", doc{.detail = R"pbdoc(
 If the :any:`ToddCoxeter` instance is not :any:`Runner.finished`,
 then it might be that equivalent input words produce different output
 words. This function triggers no congruence enumeration.)pbdoc"sv});
     def_reduce(thing, "ToddCoxeterImpl_");
+    def_reduce_many(thing, "ToddCoxeterImpl_");
     // There's no generating_pairs for ToddCoxeterImpl_ only
     // internal_generating_pairs
 
+    ////////////////////////////////////////////////////////////////////////
+    // Things from memory.hpp . . .
+    ////////////////////////////////////////////////////////////////////////
+
+    // The word graph used by ToddCoxeter stores, for every node (active or
+    // not), the targets, and two arrays of preimages, of every edge, and the
+    // node manager stores a few more values per node.
+    def_memory_usage(thing, "ToddCoxeter", [](ToddCoxeterImpl_ const& tc) {
+      auto const& wg = tc.current_word_graph();
+      return wg.number_of_nodes() * (3 * wg.out_degree() + 4)
+             * sizeof(uint32_t);
+    });
+
     ////////////////////////////////////////////////////////////////////////
     // Constructors + Initializers
     ////////////////////////////////////////////////////////////////////////
@@ -1397,6 +1416,7 @@ returned by this function may not be compatible with the relations of
     thing.def(
         "perform_lookahead",
         [](ToddCoxeterImpl_& self, bool stop_early) {
+          TraceScope trace("ToddCoxeter.perform_lookahead");
           self.perform_lookahead(stop_early);
         },
         py::arg("stop_early"),
@@ -1420,9 +1440,13 @@ settings are ignored.
 :type stop_early: bool
 )pbdoc");
 
-    thing.def("shrink_to_fit",
-              &ToddCoxeterImpl_::shrink_to_fit,
-              R"pbdoc(
+    thing.def(
+        "shrink_to_fit",
+        [](ToddCoxeterImpl_& self) {
+          TraceScope trace("ToddCoxeter.shrink_to_fit");
+          self.shrink_to_fit();
+        },
+        R"pbdoc(
 :sig=(self: ToddCoxeter) -> None:
 
 Shrink the underlying word graph to remove all dead nodes. This function
@@ -1431,10 +1455,14 @@ triggers a full enumeration and standardization, and removes from
 then this function does nothing.
 )pbdoc");
 
-    thing.def("standardize",
-              &ToddCoxeterImpl_::standardize,
-              py::arg("val"),
-              R"pbdoc(
+    thing.def(
+        "standardize",
+        [](ToddCoxeterImpl_& self, Order val) {
+          TraceScope trace("ToddCoxeter.standardize");
+          return self.standardize(val);
+        },
+        py::arg("val"),
+        R"pbdoc(
 :sig=(self: ToddCoxeter, val: Order) -> bool:
 
 Standardize :any:`ToddCoxeter.current_word_graph`.
@@ -1610,6 +1638,73 @@ collapse can be specified using :any:`large_collapse`.
    False
    >>> tc.number_of_large_collapses()
    0
+)pbdoc");
+
+    ////////////////////////////////////////////////////////////////////////
+    // Helpers
+    ////////////////////////////////////////////////////////////////////////
+
+    m.def(
+        "runner_number_of_nodes_active_at_least",
+        [](ToddCoxeterImpl_ const& tc, size_t n) {
+          return StopCondition(
+              [&tc, n]() { return tc.number_of_nodes_active() >= n; });
+        },
+        py::arg("tc"),
+        py::arg("n"),
+        py::keep_alive<0, 1>(),
+        R"pbdoc(
+:sig=(tc: ToddCoxeter, n: int) -> StopCondition:
+
+Returns a condition that is satisfied when a :any:`ToddCoxeter` instance has
+a given number of active nodes.
+
+This function returns a :any:`StopCondition` that is satisfied when
+:any:`ToddCoxeter.number_of_nodes_active` for *tc* is at least *n*.
+
+:param tc: the :any:`ToddCoxeter` instance.
+:type tc: ToddCoxeter
+
+:param n: the number of nodes.
+:type n: int
+
+:returns: A stop condition.
+:rtype: StopCondition
+)pbdoc");
+
+    m.def(
+        "runner_record_metrics",
+        [](ToddCoxeterImpl_ const& tc, MetricsStream& stream) {
+          return record_metrics(
+              tc, stream, "nodes", [](ToddCoxeterImpl_ const& x) {
+                return x.number_of_nodes_active();
+              });
+        },
+        py::arg("tc"),
+        py::arg("stream"),
+        py::keep_alive<0, 1>(),
+        py::keep_alive<0, 2>(),
+        R"pbdoc(
+:sig=(tc: ToddCoxeter, stream: MetricsStream) -> StopCondition:
+
+Returns a condition that records samples of the progress of a
+:any:`ToddCoxeter` instance.
+
+This function returns a :any:`StopCondition` that is never satisfied, but that
+records samples of the progress of *tc* in *stream* while *tc* is running.
+At most once every :any:`MetricsStream.interval`, the value of
+:any:`ToddCoxeter.number_of_nodes_active` is recorded, with name ``"nodes"``.
+The returned condition can be combined with other conditions using ``|``. When
+no sample is due, checking the condition only involves reading the clock.
+
+:param tc: the :any:`ToddCoxeter` instance.
+:type tc: ToddCoxeter
+
+:param stream: the stream where the samples are recorded.
+:type stream: MetricsStream
+
+:returns: A stop condition.
+:rtype: StopCondition
 )pbdoc");
   }  // init_todd_coxeter
 
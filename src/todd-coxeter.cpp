@@ -29,6 +29,7 @@
 // libsemigroups_pybind11....
 #include "cong-common.hpp"  // for def_construct_default
 #include "main.hpp"         // for init_todd_coxeter
+#include "trace.hpp"        // for TraceScope
 
 namespace libsemigroups {
   namespace py = pybind11;
@@ -130,11 +131,13 @@ will be empty.)pbdoc"sv});
       def_add_generating_pair(thing, "ToddCoxeter");
       def_currently_contains(thing, "ToddCoxeter");
       def_contains(thing, "ToddCoxeter");
+      def_contains_many(thing, "ToddCoxeter");
       def_reduce_no_run(thing, "ToddCoxeter", doc{.detail = R"pbdoc(
 If the :any:`ToddCoxeter` instance is not :any:`Runner.finished`,
 then it might be that equivalent input words produce different output
 words. This function triggers no congruence enumeration.)pbdoc"sv});
       def_reduce(thing, "ToddCoxeter");
+      def_reduce_many(thing, "ToddCoxeter");
 
       ////////////////////////////////////////////////////////////////////////
 
@@ -381,6 +384,7 @@ node corresponding to index *i* back to the root of that tree.
       thing.def(
           "perform_lookahead",
           [](ToddCoxeter_& self) -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookahead");
             return self.perform_lookahead();
           },
           R"pbdoc(
@@ -404,6 +408,7 @@ style and extent of this lookahead are controlled by the settings
           "perform_lookahead_for",
           [](ToddCoxeter_&            self,
              std::chrono::nanoseconds t) -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookahead");
             return self.perform_lookahead_for(t);
           },
           py::arg("t"),
@@ -427,6 +432,7 @@ happens first.
           "perform_lookahead_until",
           [](ToddCoxeter_&                self,
              std::function<bool()> const& pred) -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookahead");
             return self.perform_lookahead_until(pred);
           },
           py::arg("pred"),
@@ -448,6 +454,7 @@ This function runs a lookahead until the nullary predicate *pred* returns
       thing.def(
           "perform_lookbehind",
           [](ToddCoxeter_& self) -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookbehind");
             return self.perform_lookbehind();
           },
           R"pbdoc(
@@ -514,6 +521,7 @@ Pro).
           [](ToddCoxeter_&                           self,
              std::function<Word(Word const&)> const& collapser)
               -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookbehind");
             auto wrap = [&collapser](auto d_it, auto first, auto last) {
               Word copy(first, last);
               // Shame to do so much copying here but couldn't figure out how to
@@ -583,6 +591,7 @@ function :any:`ToddCoxeter.reduce_no_run`.
           "perform_lookbehind_for",
           [](ToddCoxeter_&            self,
              std::chrono::nanoseconds t) -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookbehind");
             return self.perform_lookbehind_for(t);
           },
           py::arg("t"),
@@ -612,6 +621,7 @@ happens first.
              std::chrono::nanoseconds                t,
              std::function<Word(Word const&)> const& collapser)
               -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookbehind");
             auto wrap = [&collapser](auto d_it, auto first, auto last) {
               Word copy(first, last);
               // Shame to do so much copying here but couldn't figure out how to
@@ -654,6 +664,7 @@ happens first. See :any:`perform_lookbehind_no_checks` for more details.
           "perform_lookbehind_until",
           [](ToddCoxeter_&                self,
              std::function<bool()> const& pred) -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookbehind");
             return self.perform_lookbehind_until(pred);
           },
           py::arg("pred"),
@@ -682,6 +693,7 @@ This function runs a lookbehind until the nullary predicate *pred* returns
              std::function<bool()> const&            pred,
              std::function<Word(Word const&)> const& collapser)
               -> detail::ToddCoxeterImpl& {
+            TraceScope trace("ToddCoxeter.perform_lookbehind");
             auto wrap = [&collapser](auto d_it, auto first, auto last) {
               Word copy(first, last);
               // Shame to do so much copying here but couldn't figure out how to
@@ -740,6 +752,12 @@ whichever happens first.
           "todd_coxeter",
           doc{.only_document_once = true, .raises = raises, .var = "tc"});
 
+      def_partition_ids<ToddCoxeter<Word>>(
+          m,
+          "ToddCoxeter",
+          "todd_coxeter",
+          doc{.only_document_once = true, .raises = raises, .var = "tc"});
+
       def_normal_forms<ToddCoxeter<Word>>(m,
                                           "ToddCoxeter",
                                           "todd_coxeter",
@@ -751,6 +769,16 @@ enumeration of ``tc``.)pbdoc",
                                               .raises             = raises,
                                               .var                = "tc"});
 
+      def_normal_forms_chunks<ToddCoxeter<Word>>(
+          m,
+          "ToddCoxeter",
+          "todd_coxeter",
+          doc{.detail             = R"pbdoc(
+This function triggers a full enumeration of ``tc``.)pbdoc",
+              .only_document_once = true,
+              .raises             = raises,
+              .var                = "tc"});
+
       ////////////////////////////////////////////////////////////////////////
       // Helper functions - specific to ToddCoxeter
       ////////////////////////////////////////////////////////////////////////
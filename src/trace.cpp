@@ -0,0 +1,245 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+// C++ stl headers....
+#include <algorithm>      // for remove_if
+#include <atomic>         // for atomic
+#include <chrono>         // for steady_clock, duration
+#include <cstddef>        // for size_t
+#include <fstream>        // for ofstream
+#include <memory>         // for shared_ptr, make_shared
+#include <mutex>          // for mutex, lock_guard
+#include <string>         // for string
+#include <unordered_set>  // for unordered_set
+#include <utility>        // for move
+#include <vector>         // for vector
+
+// libsemigroups headers
+#include <libsemigroups/exception.hpp>  // for LIBSEMIGROUPS_EXCEPTION
+
+#include <fmt/format.h>  // for format
+
+// pybind11....
+#include <pybind11/pybind11.h>
+
+// libsemigroups_pybind11....
+#include "main.hpp"   // for init_trace
+#include "trace.hpp"  // for tracing_enabled, trace_event
+
+namespace libsemigroups {
+  namespace py = pybind11;
+
+  namespace {
+    using std::chrono::steady_clock;
+
+    struct TraceEvent {
+      char const*              name;
+      char                     phase;
+      steady_clock::time_point time;
+    };
+
+    // The events recorded by a single thread. The mutex is only ever
+    // contended while the trace is being cleared or written.
+    struct ThreadTrace {
+      std::mutex              mtx;
+      size_t                  id;
+      std::vector<TraceEvent> events;
+    };
+
+    std::atomic<bool> tracing(false);
+
+    std::mutex                                threads_mtx;
+    size_t                                    next_thread_id = 1;
+    std::vector<std::shared_ptr<ThreadTrace>> threads;
+    steady_clock::time_point                  trace_start;
+
+    ThreadTrace& this_thread_trace() {
+      thread_local std::shared_ptr<ThreadTrace> local = []() {
+        auto                        result = std::make_shared<ThreadTrace>();
+        std::lock_guard<std::mutex> lock(threads_mtx);
+        result->id = next_thread_id++;
+        threads.push_back(result);
+        return result;
+      }();
+      return *local;
+    }
+
+    void clear_trace() {
+      std::lock_guard<std::mutex> lock(threads_mtx);
+      // Forget the threads that no longer exist
+      threads.erase(std::remove_if(threads.begin(),
+                                   threads.end(),
+                                   [](auto const& t) {
+                                     return t.use_count() == 1;
+                                   }),
+                    threads.end());
+      for (auto& t : threads) {
+        std::lock_guard<std::mutex> thread_lock(t->mtx);
+        t->events.clear();
+      }
+      trace_start = steady_clock::now();
+    }
+
+    void write_trace(std::string const& filename) {
+      std::ofstream file(filename);
+      if (!file) {
+        LIBSEMIGROUPS_EXCEPTION("cannot open the file {} for writing",
+                                filename);
+      }
+      std::lock_guard<std::mutex> lock(threads_mtx);
+      char const*                 sep = "";
+      file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+      for (auto& t : threads) {
+        std::lock_guard<std::mutex> thread_lock(t->mtx);
+        if (t->events.empty()) {
+          continue;
+        }
+        file << fmt::format("{}\n{{\"name\": \"thread_name\", \"ph\": \"M\", "
+                            "\"pid\": 0, \"tid\": {}, "
+                            "\"args\": {{\"name\": \"thread {}\"}}}}",
+                            sep,
+                            t->id,
+                            t->id);
+        sep = ",";
+        for (auto const& e : t->events) {
+          double ts = std::chrono::duration<double, std::micro>(e.time
+                                                                - trace_start)
+                          .count();
+          file << fmt::format(",\n{{\"name\": \"{}\", \"ph\": \"{}\", "
+                              "\"ts\": {:.3f}, \"pid\": 0, \"tid\": {}}}",
+                              e.name,
+                              e.phase,
+                              ts,
+                              t->id);
+        }
+      }
+      file << "\n]}\n";
+      if (!file) {
+        LIBSEMIGROUPS_EXCEPTION("failed to write to the file {}", filename);
+      }
+    }
+  }  // namespace
+
+  bool tracing_enabled() noexcept {
+    return tracing.load(std::memory_order_relaxed);
+  }
+
+  void trace_event(char const* name, char phase) {
+    auto                        now = steady_clock::now();
+    ThreadTrace&                t   = this_thread_trace();
+    std::lock_guard<std::mutex> lock(t.mtx);
+    t.events.push_back(TraceEvent{name, phase, now});
+  }
+
+  char const* intern_trace_name(std::string name) {
+    // The elements of an unordered_set are never moved, and this is never
+    // destroyed, so that the pointers returned remain valid.
+    static auto*                names = new std::unordered_set<std::string>();
+    static std::mutex           names_mtx;
+    std::lock_guard<std::mutex> lock(names_mtx);
+    return names->insert(std::move(name)).first->c_str();
+  }
+
+  void init_trace(py::module& m) {
+    m.def(
+        "runner_start_tracing",
+        []() {
+          clear_trace();
+          tracing = true;
+        },
+        R"pbdoc(
+:sig=() -> None:
+
+Start recording a trace of the phases of algorithms.
+
+This function discards any previously recorded events and starts recording a
+trace. While tracing is enabled, a begin and an end event is recorded, in the
+thread where it happens, for each of the following:
+
+* running any :any:`Runner`, for example, via :any:`Runner.run`,
+  :any:`Runner.run_for`, :any:`Runner.run_until`, :any:`runner.race`, or
+  any function that triggers a full enumeration, such as
+  :any:`ToddCoxeter.number_of_classes` or :any:`FroidurePin.size`;
+* each call to :any:`FroidurePin.enumerate`;
+* lookaheads, lookbehinds and standardizations in :any:`ToddCoxeter`;
+* each call to :any:`Sims1.number_of_congruences`, :any:`Sims1.for_each` or
+  :any:`Sims1.find_if` (and the analogous functions of :any:`Sims2`), and to
+  :any:`RepOrc.word_graph` and :any:`MinimalRepOrc.word_graph`.
+
+When tracing is disabled, the overhead is a single atomic load per such call.
+The trace can be written to a file using :any:`runner.write_trace`.
+
+.. doctest:: Python
+
+   >>> from libsemigroups_pybind11 import (Presentation, presentation,
+   ... ToddCoxeter, congruence_kind, runner)
+   >>> p = Presentation("ab")
+   >>> presentation.add_rule(p, "aaa", "a")
+   >>> presentation.add_rule(p, "bb", "b")
+   >>> presentation.add_rule(p, "ab", "ba")
+   >>> tc = ToddCoxeter(congruence_kind.twosided, p)
+   >>> runner.start_tracing()
+   >>> tc.number_of_classes()
+   5
+   >>> runner.stop_tracing()
+   >>> runner.write_trace("todd-coxeter.json")  # doctest: +SKIP
+)pbdoc");
+    m.def(
+        "runner_stop_tracing",
+        []() { tracing = false; },
+        R"pbdoc(
+:sig=() -> None:
+
+Stop recording a trace of the phases of algorithms.
+
+This function stops recording events, but keeps the events recorded since the
+last call to :any:`runner.start_tracing`, so that they can be written using
+:any:`runner.write_trace`. The end events of any phases that are in progress
+when this function is called are still recorded.
+)pbdoc");
+    m.def("runner_is_tracing",
+          &tracing_enabled,
+          R"pbdoc(
+:sig=() -> bool:
+
+Check whether or not a trace is being recorded.
+
+:returns: Whether or not a trace is being recorded.
+:rtype: bool
+)pbdoc");
+    m.def("runner_write_trace",
+          &write_trace,
+          py::arg("filename"),
+          R"pbdoc(
+:sig=(filename: str) -> None:
+
+Write the recorded trace to a file.
+
+This function writes the events recorded since the last call to
+:any:`runner.start_tracing` to the file *filename* in the Chrome trace event
+JSON format, which can be viewed in ``chrome://tracing`` or Perfetto. Each
+thread that recorded any events gets its own track. Timestamps are in
+microseconds since the last call to :any:`runner.start_tracing`.
+
+:param filename: the name of the file.
+:type filename: str
+
+:raises LibsemigroupsError: if the file cannot be written.
+)pbdoc");
+  }
+}  // namespace libsemigroups
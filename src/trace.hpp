@@ -0,0 +1,68 @@
+//
+// libsemigroups_pybind11
+// Copyright (C) 2025 James D. Mitchell
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+
+#ifndef SRC_TRACE_HPP_
+#define SRC_TRACE_HPP_
+
+#include <string>  // for string
+
+namespace libsemigroups {
+
+  // Returns true if tracing was enabled by runner.start_tracing, and not
+  // subsequently disabled.
+  bool tracing_enabled() noexcept;
+
+  // Record an event with the given name in the trace of the calling thread.
+  // The parameter phase should be 'B' (begin) or 'E' (end), as in the Chrome
+  // trace event format, and name must be a string literal, or returned by
+  // intern_trace_name.
+  void trace_event(char const* name, char phase);
+
+  // Returns a pointer to a copy of name that is valid until the program
+  // exits, for names such as "ToddCoxeter.contains" that are only known when
+  // a function is bound. Calling this twice with the same name returns the
+  // same pointer.
+  char const* intern_trace_name(std::string name);
+
+  // Records a begin event on construction and the matching end event on
+  // destruction, if tracing is enabled on construction. When tracing is
+  // disabled, this costs a single relaxed atomic load.
+  class TraceScope {
+   public:
+    explicit TraceScope(char const* name)
+        : _name(tracing_enabled() ? name : nullptr) {
+      if (_name != nullptr) {
+        trace_event(_name, 'B');
+      }
+    }
+
+    TraceScope(TraceScope const&)            = delete;
+    TraceScope& operator=(TraceScope const&) = delete;
+
+    ~TraceScope() {
+      if (_name != nullptr) {
+        trace_event(_name, 'E');
+      }
+    }
+
+   private:
+    char const* _name;
+  };
+}  // namespace libsemigroups
+
+#endif  // SRC_TRACE_HPP_
@@ -29,8 +29,9 @@
 
 // libsemigroups_pybind11....
 #include "debug.hpp"
-#include "errors.hpp"  // for formatted_error_message
-#include "main.hpp"    // for init_transf
+#include "errors.hpp"          // for formatted_error_message
+#include "main.hpp"            // for init_transf
+#include "static-ptransf.hpp"  // for for_each_static_ptransf_degree
 
 namespace libsemigroups {
 
@@ -38,7 +39,9 @@ namespace libsemigroups {
 
   namespace {
 
-    template <typename Thing>
+    // The parameter N is the degree of the bound type if it is static, and 0 if
+    // it is dynamic.
+    template <size_t N, typename Thing>
     void bind_ptransf_subclass(py::module&      m,
                                Thing&           thing,
                                std::string_view long_name,
@@ -200,14 +203,17 @@ yielding these values.
                       long_name)
               .c_str());
 
-      thing.def(
-          "increase_degree_by",
-          [](PTransfSubclass& self, size_t m) -> PTransfSubclass& {
-            return static_cast<PTransfSubclass&>(self.increase_degree_by(m));
-          },
-          py::arg("m"),
-          fmt::format(
-              R"pbdoc(
+      // The degree of a static transformation cannot be changed, the Python
+      // classes replace such objects by objects of another type instead.
+      if constexpr (N == 0) {
+        thing.def(
+            "increase_degree_by",
+            [](PTransfSubclass& self, size_t m) -> PTransfSubclass& {
+              return static_cast<PTransfSubclass&>(self.increase_degree_by(m));
+            },
+            py::arg("m"),
+            fmt::format(
+                R"pbdoc(
 :sig=(self: {0}, m: int) -> {0}:
 
 Increases the degree of *self* in-place, leaving existing values unaltered.
@@ -221,8 +227,9 @@ Increases the degree of *self* in-place, leaving existing values unaltered.
 :complexity:
    At worst linear in the sum of the parameter *m* and :py:meth:`degree`.
 )pbdoc",
-              doc_type_name)
-              .c_str());
+                doc_type_name)
+                .c_str());
+      }
 
       thing.def_static("one",
                        &PTransfSubclass::one,
@@ -395,7 +402,9 @@ of :math:`f`. A transformation is stored as a list of the images of :math:`\{0,
 1, \ldots, n - 1\}`, i.e. :math:`[(0)f, (1)f, \ldots, (n - 1)f]`.
 
 Transformations are optimised for the number of points in the image with
-fewer points requiring less space per point.
+fewer points requiring less space per point. Those of degree at most ``16``, or
+of degree ``32``, are stored with their degree fixed at compile time, which
+makes products, comparisons, and hashing faster.
 
 .. doctest::
 
@@ -451,7 +460,7 @@ fewer points requiring less space per point.
       // thing.attr("__qualname__") = "Transf";
       // thing.attr("__module__") = "libsemigroups_pybind11";
 
-      bind_ptransf_subclass(m, thing, "transformation", name, "Transf");
+      bind_ptransf_subclass<N>(m, thing, "transformation", name, "Transf");
 
       thing.def("__repr__", [name](Transf_ const& f) {
         return to_input_string(f, name, "[]");
@@ -477,7 +486,9 @@ i.e. :math:`((0)f, (1)f, \ldots, (n - 1)f)` where the value
 among the points where :math:`f` is defined).
 
 These partial permutations are optimised for the number of points in the image
-with fewer points requiring less space per point.
+with fewer points requiring less space per point. Those of degree at most
+``16``, or of degree ``32``, are stored with their degree fixed at compile
+time, which makes products, comparisons, and hashing faster.
 
 .. doctest::
 
@@ -530,7 +541,7 @@ with fewer points requiring less space per point.
    True
 )pbdoc");
 
-      bind_ptransf_subclass(m, thing, "partial perm", name, "PPerm");
+      bind_ptransf_subclass<N>(m, thing, "partial perm", name, "PPerm");
 
       thing.def("__repr__", [name](PPerm_ const& f) {
         return to_input_string(f, name, "[]");
@@ -682,7 +693,9 @@ of :math:`\{0, 1, \ldots, n - 1\}` for some integer :math:`n` called the
 :math:`((0)f, (1)f, \ldots, (n - 1)f)`.
 
 Permutations are optimised for the number of points in the image with
-fewer points requiring less space per point.
+fewer points requiring less space per point. Those of degree at most ``16``, or
+of degree ``32``, are stored with their degree fixed at compile time, which
+makes products, comparisons, and hashing faster.
 
 .. doctest::
 
@@ -731,7 +744,7 @@ fewer points requiring less space per point.
    {Perm([1, 0, 2])}
 )pbdoc");
 
-      bind_ptransf_subclass(m, thing, "permutation", name, "Perm");
+      bind_ptransf_subclass<N>(m, thing, "permutation", name, "Perm");
 
       thing.def("__repr__", [name](Perm_ const& f) {
         return to_input_string(f, name, "[]");
@@ -760,5 +773,16 @@ fewer points requiring less space per point.
     bind_pperm<0, uint8_t>(m, "PPerm1");
     bind_pperm<0, uint16_t>(m, "PPerm2");
     bind_pperm<0, uint32_t>(m, "PPerm4");
+
+    // Static degrees
+    py::list degrees;
+    for_each_static_ptransf_degree([&m, &degrees](auto n) {
+      constexpr size_t N = decltype(n)::value;
+      bind_transf<N, uint8_t>(m, static_ptransf_name("Transf", N));
+      bind_perm<N, uint8_t>(m, static_ptransf_name("Perm", N));
+      bind_pperm<N, uint8_t>(m, static_ptransf_name("PPerm", N));
+      degrees.append(N);
+    });
+    m.attr("STATIC_PTRANSF_DEGREES") = py::tuple(degrees);
   }
 }  // namespace libsemigroups
@@ -24,9 +24,11 @@
 #include <libsemigroups/config.hpp>     // for LIBSEMIGROUPS_EIGEN_ENABLED
 #include <libsemigroups/constants.hpp>  // for operator!=, operator==
 #include <libsemigroups/detail/int-range.hpp>  // for IntegralRange<>::value_type
+#include <libsemigroups/exception.hpp>         // for LIBSEMIGROUPS_EXCEPTION
 #include <libsemigroups/word-graph.hpp>        // for WordGraph
 
 // pybind11....
+#include <pybind11/numpy.h>      // for array_t, buffer_info
 #include <pybind11/operators.h>  // for self, self_t, operator!=, operator*
 #include <pybind11/pybind11.h>   // for class_, make_iterator, init, enum_
 #include <pybind11/stl.h>        // for conversion of C++ to py types
@@ -49,6 +51,7 @@ namespace libsemigroups {
 
     py::class_<WordGraph_> thing(m,
                                  "WordGraph",
+                                 py::buffer_protocol(),
                                  R"pbdoc(
 Class for representing word graphs.
 
@@ -56,7 +59,50 @@ Instances of this class represent word graphs. If the word graph has ``n``
 nodes, they are represented by the numbers :math:`\{0, ..., n - 1\}`, and every
 node has the same number ``m`` of out-edges (edges with that node as source and
 any other node or :any:`UNDEFINED` as target). The number ``m`` is referred to as
-the *out-degree* of the word graph, or any of its nodes.)pbdoc");
+the *out-degree* of the word graph, or any of its nodes.
+
+Word graphs support the buffer protocol, and so the targets of a word graph can
+be viewed, without being copied, as a read-only NumPy array of shape
+``(number_of_nodes(), out_degree())`` and dtype ``uint32``, using
+:any:`numpy.asarray`. Undefined targets are represented by ``2 ** 32 - 1``.
+Such an array refers to the memory of the word graph, and so it must not be
+used after the word graph is modified in any way that changes its number of
+nodes or its out-degree.
+
+.. doctest::
+
+  >>> import numpy
+  >>> from libsemigroups_pybind11 import WordGraph
+  >>> wg = WordGraph(3, [[1, 2], [2], [0, 0]])
+  >>> numpy.asarray(wg)
+  array([[         1,          2],
+         [         2, 4294967295],
+         [         0,          0]], dtype=uint32)
+)pbdoc");
+
+    thing.def_buffer([](WordGraph_ const& self) {
+      // The targets are stored row by row in a single array, but every row
+      // might have some unused capacity at its end, and so the stride between
+      // rows is determined from the addresses of the first two rows.
+      static node_type const empty = 0;
+      size_t const           nodes = self.number_of_nodes();
+      size_t const           deg   = self.out_degree();
+      if (nodes == 0 || deg == 0) {
+        return py::buffer_info(const_cast<node_type*>(&empty),
+                               {nodes, deg},
+                               {deg * sizeof(node_type), sizeof(node_type)},
+                               true);
+      }
+      node_type const* first = &*self.cbegin_targets_no_checks(0);
+      size_t           row   = deg;
+      if (nodes > 1) {
+        row = static_cast<size_t>(&*self.cbegin_targets_no_checks(1) - first);
+      }
+      return py::buffer_info(const_cast<node_type*>(first),
+                             {nodes, deg},
+                             {row * sizeof(node_type), sizeof(node_type)},
+                             true);
+    });
 
     thing.def("__repr__", [](WordGraph_ const& self) {
       return to_human_readable_repr(self);
@@ -139,6 +185,74 @@ out-degree is specified by the length of the first item in *targets*.
   >>> WordGraph(5, [[0, 0], [1, 1], [2], [3, 3]])
   <WordGraph with 5 nodes, 7 edges, & out-degree 2>
 
+)pbdoc");
+
+    thing.def(
+        py::init([](py::array_t<node_type> const& targets) {
+          if (targets.ndim() != 2) {
+            LIBSEMIGROUPS_EXCEPTION(
+                "expected a 2-dimensional array, found {} dimensions",
+                targets.ndim());
+          } else if (!(targets.flags() & py::array::c_style)) {
+            LIBSEMIGROUPS_EXCEPTION("expected a C-contiguous array");
+          }
+          size_t const     nodes = targets.shape(0);
+          size_t const     deg   = targets.shape(1);
+          node_type const* data  = targets.data();
+          for (size_t i = 0; i < nodes * deg; ++i) {
+            if (data[i] >= nodes
+                && data[i] != static_cast<node_type>(UNDEFINED)) {
+              LIBSEMIGROUPS_EXCEPTION(
+                  "target value out of bounds, expected values in the range "
+                  "[0, {}) or UNDEFINED, found {} in position ({}, {})",
+                  nodes,
+                  data[i],
+                  i / deg,
+                  i % deg);
+            }
+          }
+          WordGraph_ result(nodes, deg);
+          for (size_t s = 0; s < nodes; ++s) {
+            for (size_t a = 0; a < deg; ++a) {
+              result.target_no_checks(s, a, data[s * deg + a]);
+            }
+          }
+          return result;
+        }),
+        py::arg("targets").noconvert(),
+        R"pbdoc(
+:sig=(self: WordGraph, targets: numpy.ndarray) -> None:
+
+Construct a word graph from a NumPy array of targets.
+
+This function constructs a word graph from the C-contiguous NumPy array
+*targets* of dtype ``uint32`` and shape ``(m, n)``, where ``m`` is the number of
+nodes and ``n`` is the out-degree of the word graph. The target of the edge
+with source ``s`` and label ``a`` is ``targets[s, a]``, and undefined targets
+are represented by ``2 ** 32 - 1``. The values in *targets* are read directly
+from the memory of the array, and are not converted one at a time to Python
+objects, and so this is much faster than constructing a word graph from a list
+of targets. This is the inverse of :any:`numpy.asarray` applied to a word
+graph.
+
+:param targets: the array of targets.
+:type targets: numpy.ndarray
+
+:raises TypeError: if *targets* is not a NumPy array of dtype ``uint32``.
+
+:raises LibsemigroupsError:
+    if *targets* is not 2-dimensional, or is not C-contiguous.
+
+:raises LibsemigroupsError:
+    if any value in *targets* is not :any:`UNDEFINED` and is greater than or
+    equal to the number of nodes.
+
+.. doctest::
+
+  >>> import numpy
+  >>> from libsemigroups_pybind11 import WordGraph
+  >>> WordGraph(numpy.array([[0, 1], [1, 0]], dtype=numpy.uint32))
+  <WordGraph with 2 nodes, 4 edges, & out-degree 2>
 )pbdoc");
 
     thing.def("add_nodes",
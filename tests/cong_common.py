@@ -8,7 +8,12 @@
 CongruenceCommon.
 """
 
-from libsemigroups_pybind11 import Presentation, congruence_kind, presentation
+import itertools
+
+import numpy as np
+import pytest
+
+from libsemigroups_pybind11 import LibsemigroupsError, Presentation, congruence_kind, presentation
 
 
 def check_congruence_common_return_policy(TestType):  # pylint: disable=missing-function-docstring, invalid-name
@@ -24,3 +29,91 @@ def check_congruence_common_return_policy(TestType):  # pylint: disable=missing-
     assert c.presentation() is c.presentation()
     assert c.generating_pairs() is not c.generating_pairs()
     return c
+
+
+def _pack(words):
+    offsets = np.cumsum([0] + [len(w) for w in words], dtype=np.uint64)
+    if all(isinstance(w, str) for w in words):
+        return np.frombuffer("".join(words).encode(), dtype=np.uint8), offsets
+    return np.array([a for w in words for a in w], dtype=np.uint32), offsets
+
+
+def _unpack(letters, offsets, string):
+    words = [letters[offsets[i] : offsets[i + 1]] for i in range(len(offsets) - 1)]
+    if string:
+        return [bytes(w).decode() for w in words]
+    return [[int(a) for a in w] for w in words]
+
+
+def check_contains_many_and_reduce_many(c, alphabet, length):  # pylint: disable=missing-function-docstring
+    string = isinstance(alphabet, str)
+    words = [
+        "".join(w) if string else list(w)
+        for n in range(1, length + 1)
+        for w in itertools.product(alphabet, repeat=n)
+    ]
+    pairs = list(itertools.product(words, repeat=2))
+    expected_reduce = [c.reduce(w) for w in words]
+    expected_contains = [c.contains(u, v) for u, v in pairs]
+
+    for threads in (1, 3):
+        assert c.reduce_many(words, threads) == expected_reduce
+        assert c.reduce_many(words, threads=threads) == expected_reduce
+        assert c.contains_many(pairs, threads).tolist() == expected_contains
+        letters, offsets = c.reduce_many(*_pack(words), threads)
+        assert _unpack(letters, offsets, string) == expected_reduce
+        flat = [w for pair in pairs for w in pair]
+        assert c.contains_many(*_pack(flat), threads).tolist() == expected_contains
+
+    assert c.reduce_many([]) == []
+    assert c.contains_many([]).tolist() == []
+    letters, offsets = _pack(words)
+    with pytest.raises(LibsemigroupsError):
+        c.contains_many(letters, offsets[:-1])  # odd number of words
+    with pytest.raises(LibsemigroupsError):
+        c.reduce_many(letters, offsets[::-1].copy())
+    with pytest.raises(LibsemigroupsError):
+        c.reduce_many(letters[:-1].copy(), offsets)
+
+
+def check_normal_forms_chunks(module, c, count):  # pylint: disable=missing-function-docstring
+    expected = list(itertools.islice(module.normal_forms(c), count))
+    string = isinstance(expected[0], str)
+
+    for batch_size in (1, 3, 64):
+        found = []
+        for letters, offsets in module.normal_forms_chunks(c, batch_size):
+            assert offsets[0] == 0
+            assert 1 <= len(offsets) - 1 <= batch_size
+            found += _unpack(letters, offsets, string)
+            if len(found) >= count:
+                break
+        assert found[:count] == expected
+
+    with pytest.raises(LibsemigroupsError):
+        module.normal_forms_chunks(c, 0)
+
+
+def check_partition_ids(module, c, alphabet, length):  # pylint: disable=missing-function-docstring
+    string = isinstance(alphabet, str)
+    words = [
+        "".join(w) if string else list(w)
+        for n in range(1, length + 1)
+        for w in itertools.product(alphabet, repeat=n)
+    ]
+    ids = {}
+    expected = [ids.setdefault(str(c.reduce(w)), len(ids)) for w in words]
+
+    for threads in (1, 3):
+        result = module.partition_ids(c, words, threads)
+        assert result.dtype == np.uint64
+        assert result.tolist() == expected
+        assert module.partition_ids(c, *_pack(words), threads=threads).tolist() == expected
+
+    classes = {}
+    for w, i in zip(words, expected, strict=True):
+        classes.setdefault(i, []).append(w)
+    assert sorted(sorted(x) for x in classes.values() if len(x) > 1) == sorted(
+        sorted(x) for x in module.non_trivial_classes(c, words)
+    )
+    assert module.partition_ids(c, []).tolist() == []
@@ -28,7 +28,11 @@ from libsemigroups_pybind11 import (
     presentation,
 )
 
-from .cong_common import check_congruence_common_return_policy
+from .cong_common import (
+    check_congruence_common_return_policy,
+    check_contains_many_and_reduce_many,
+    check_partition_ids,
+)
 
 
 def test_018():
@@ -591,3 +595,19 @@ def test_congruence_return_policy():
     c = check_congruence_common_return_policy(Congruence)
 
     assert c.max_threads(2) is c
+
+
+def test_congruence_contains_many():
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1], [1, 0])
+    check_contains_many_and_reduce_many(Congruence(congruence_kind.twosided, p), [0, 1], 4)
+
+
+def test_congruence_partition_ids():
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    check_partition_ids(congruence, Congruence(congruence_kind.twosided, p), "ab", 5)
@@ -11,6 +11,7 @@
 import contextlib
 from datetime import timedelta
 
+import numpy as np
 import pytest
 
 from libsemigroups_pybind11 import (
@@ -110,6 +111,16 @@ def check_mem_compare(S):
     for x in S:
         assert S.sorted_position(x) == S.to_sorted_position(S.position(x))
 
+    # *_many
+    xs = list(S)
+    assert S.position_many(xs).tolist() == list(range(S.size()))
+    assert S.current_position_many(xs).tolist() == list(range(S.size()))
+    assert S.sorted_position_many(xs).tolist() == [S.sorted_position(x) for x in xs]
+    assert S.contains_many(xs).tolist() == [True] * S.size()
+    words = [froidure_pin.factorisation(S, i) for i in range(S.size())]
+    assert froidure_pin.position_many(S, words).tolist() == list(range(S.size()))
+    assert froidure_pin.current_position_many(S, words).tolist() == list(range(S.size()))
+
     for x in S.idempotents():
         w = froidure_pin.factorisation(S, x)
         assert froidure_pin.equal_to(S, w + w, w)
@@ -219,6 +230,26 @@ def check_factor_prod_rels(S):
         assert froidure_pin.current_position(S, lhs) == froidure_pin.current_position(S, rhs)
         assert froidure_pin.factorisation(S, froidure_pin.current_position(S, rhs)) == rhs
 
+    # normal_forms_chunks, rules_chunks
+    for batch_size in (1, 5, 1024):
+        words = []
+        for letters, offsets in froidure_pin.normal_forms_chunks(S, batch_size):
+            assert 1 <= len(offsets) - 1 <= batch_size
+            words += [
+                letters[offsets[i] : offsets[i + 1]].tolist() for i in range(len(offsets) - 1)
+            ]
+        assert words == list(froidure_pin.normal_forms(S))
+
+        words = []
+        for letters, offsets in froidure_pin.rules_chunks(S, batch_size):
+            assert 2 <= len(offsets) - 1 <= 2 * batch_size
+            words += [
+                letters[offsets[i] : offsets[i + 1]].tolist() for i in range(len(offsets) - 1)
+            ]
+        assert list(zip(words[::2], words[1::2], strict=True)) == list(froidure_pin.rules(S))
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.normal_forms_chunks(S, 0)
+
     # product_by_reduction + fast_product
     try:
         for i in range(S.size()):
@@ -820,3 +851,108 @@ def test_froidure_pin_kbe_word():  # pylint: disable=too-many-statements
     assert froidure_pin.minimal_factorisation(S, [0] * 2) == [0, 0]
 
     assert froidure_pin.to_element(S, [0, 0]) == [0, 0]
+
+
+def test_froidure_pin_snapshot(tmp_path):
+    filename = str(tmp_path / "fp.bin")
+    S = FroidurePin([Transf([1, 0, 2]), Transf([1, 2, 0]), Transf([0, 0, 1])])
+    S.enumerate(10)
+    S.save_snapshot(filename)
+
+    arrays = froidure_pin.snapshot_arrays(filename)
+    assert "sorted_position" not in arrays
+    assert arrays["generators"].tolist() == [[1, 0, 2], [1, 2, 0], [0, 0, 1]]
+    n = S.current_size()
+    assert arrays["elements"].shape == (n, 3)
+    assert [Transf(x) for x in arrays["elements"].tolist()] == list(S.current_elements())
+    assert arrays["prefix"].shape == (n,)
+    for i in range(n):
+        assert arrays["length"][i] == S.current_length(i)
+        if S.current_length(i) > 1:
+            assert arrays["prefix"][i] == S.prefix(i)
+
+    assert S.size() == 27
+    S.save_snapshot(filename)
+    arrays = froidure_pin.snapshot_arrays(filename)
+    assert arrays["right_cayley_graph"].tolist() == [
+        list(S.right_cayley_graph().targets(i)) for i in range(27)
+    ]
+    assert arrays["sorted_position"].tolist() == [S.to_sorted_position(i) for i in range(27)]
+    with pytest.raises(ValueError):
+        arrays["elements"][0, 0] = 1
+
+    with pytest.raises(NotImplementedError):
+        FroidurePin(Bipartition([[1, -1], [2, -2]])).save_snapshot(filename)
+
+    with open(filename, "wb") as file:
+        file.write(b"not a snapshot")
+    with pytest.raises(ValueError):
+        froidure_pin.snapshot_arrays(filename)
+
+
+def test_froidure_pin_position_many():
+    S = FroidurePin(Transf([1, 0, 1]), Transf([0, 0, 0]))
+    xs = [Transf([1, 0, 1]), Transf([0, 0, 0]), Transf([2, 2, 2])]
+    assert S.current_position_many(xs).tolist() == [0, 1, -1]
+    assert S.position_many(xs).tolist() == [0, 1, -1]
+    assert S.contains_many(xs).tolist() == [True, True, False]
+    assert S.sorted_position_many(xs).tolist() == [S.sorted_position(x) for x in xs[:2]] + [-1]
+
+    images = np.array([[1, 0, 1], [0, 0, 0], [2, 2, 2]])
+    assert S.position_many(images).tolist() == [0, 1, -1]
+    assert S.contains_many(images).tolist() == [True, True, False]
+    assert S.position_many(np.empty((0, 3), dtype=np.uint8)).tolist() == []
+    with pytest.raises(LibsemigroupsError):
+        S.position_many(np.array([1, 0, 1]))
+    with pytest.raises(LibsemigroupsError):
+        S.position_many(np.array([[1, 0, 3]]))
+
+    letters = np.array([0, 1, 0, 0, 1, 0], dtype=np.uint64)
+    offsets = np.array([0, 1, 2, 4, 6], dtype=np.uint64)
+    assert froidure_pin.position_many(S, letters, offsets).tolist() == [0, 1, 2, 3]
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.position_many(S, [[0, 2]])
+
+    S = FroidurePin(PPerm([0, 1], [1, 0], 3), PPerm([0], [0], 3))
+    images = np.array([[1, 0, -1], [0, -1, -1], [2, -1, -1]])
+    assert S.position_many(images).tolist() == [0, 1, -1]
+
+
+def test_froidure_pin_minimal_factorisation_many():
+    S = FroidurePin(Transf([1, 0, 2, 3]), Transf([1, 2, 3, 0]), Transf([0, 0, 1, 2]))
+    S.batch_size(10).enumerate(20)
+    n = S.current_size()
+    assert n < 200
+
+    def words(letters, offsets):
+        return [letters[offsets[i] : offsets[i + 1]].tolist() for i in range(len(offsets) - 1)]
+
+    expected = [froidure_pin.current_minimal_factorisation(S, i) for i in range(n)]
+    for threads in (1, 3, 64):
+        assert words(*froidure_pin.current_minimal_factorisation_many(S, None, threads)) == expected
+    assert S.current_size() == n
+    positions = np.array([n - 1, 0, 5, 5])
+    assert words(*froidure_pin.current_minimal_factorisation_many(S, positions, 2)) == [
+        expected[i] for i in positions
+    ]
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.current_minimal_factorisation_many(S, [n])
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.current_minimal_factorisation_many(S, [-1])
+    with pytest.raises(LibsemigroupsError):
+        froidure_pin.current_minimal_factorisation_many(S, [[0]])
+
+    letters, offsets = froidure_pin.minimal_factorisation_many(S, [200])
+    assert S.current_size() > 200
+    assert not S.finished()
+    assert words(letters, offsets) == [froidure_pin.minimal_factorisation(S, 200)]
+
+    letters, offsets = froidure_pin.minimal_factorisation_many(S, number_of_threads=4)
+    assert S.finished()
+    assert len(offsets) == S.size() + 1
+    assert words(letters, offsets) == [
+        froidure_pin.minimal_factorisation(S, i) for i in range(S.size())
+    ]
+    letters, offsets = froidure_pin.minimal_factorisation_many(S, [])
+    assert letters.tolist() == []
+    assert offsets.tolist() == [0]
@@ -21,7 +21,12 @@ from libsemigroups_pybind11 import (
     ukkonen,
 )
 
-from .cong_common import check_congruence_common_return_policy
+from .cong_common import (
+    check_congruence_common_return_policy,
+    check_contains_many_and_reduce_many,
+    check_normal_forms_chunks,
+    check_partition_ids,
+)
 
 ###############################################################################
 # Helper functions
@@ -294,3 +299,24 @@ def test_kambites_return_policy():
     k = check_congruence_common_return_policy(Kambites)
 
     assert k.ukkonen() is k.ukkonen()
+
+
+def test_kambites_contains_many():
+    p = Presentation("abcdefg")
+    presentation.add_rule(p, "abcd", "aaaeaa")
+    presentation.add_rule(p, "ef", "dg")
+    check_contains_many_and_reduce_many(Kambites(congruence_kind.twosided, p), "abcdefg", 2)
+
+
+def test_kambites_normal_forms_chunks():
+    p = Presentation("abcdefg")
+    presentation.add_rule(p, "abcd", "aaaeaa")
+    presentation.add_rule(p, "ef", "dg")
+    check_normal_forms_chunks(kambites, Kambites(congruence_kind.twosided, p), 1000)
+
+
+def test_kambites_partition_ids():
+    p = Presentation("abcdefg")
+    presentation.add_rule(p, "abcd", "aaaeaa")
+    presentation.add_rule(p, "ef", "dg")
+    check_partition_ids(kambites, Kambites(congruence_kind.twosided, p), "abcdefg", 3)
@@ -27,7 +27,12 @@ from libsemigroups_pybind11 import (
     presentation,
 )
 
-from .cong_common import check_congruence_common_return_policy
+from .cong_common import (
+    check_congruence_common_return_policy,
+    check_contains_many_and_reduce_many,
+    check_normal_forms_chunks,
+    check_partition_ids,
+)
 from .runner import check_runner
 
 
@@ -366,3 +371,41 @@ def test_rpo():
 #     assert k.presentation().alphabet() == p.alphabet()
 #     assert k.presentation().rules == p.rules
 #     assert list(k.active_rules()) == [(expected, "a")]
+
+
+def test_knuth_bendix_contains_many():
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    for rws in ("Set", "Trie"):
+        kb = KnuthBendix(congruence_kind.twosided, p, rewriting_system=rws)
+        check_contains_many_and_reduce_many(kb, "ab", 4)
+
+
+def test_knuth_bendix_normal_forms_chunks():
+    p = Presentation("abc")
+    presentation.add_rule(p, "aaaa", "a")
+    presentation.add_rule(p, "bbbb", "b")
+    presentation.add_rule(p, "cccc", "c")
+    presentation.add_rule(p, "abab", "aaa")
+    presentation.add_rule(p, "bcbc", "bbb")
+    for rws in ("Set", "Trie"):
+        kb = KnuthBendix(congruence_kind.twosided, p, rewriting_system=rws)
+        check_normal_forms_chunks(knuth_bendix, kb, 500)
+
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1], [1, 0])
+    check_normal_forms_chunks(knuth_bendix, KnuthBendix(congruence_kind.twosided, p), 100)
+
+
+def test_knuth_bendix_partition_ids():
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 1], [1, 0])
+    for rws in ("Set", "Trie"):
+        kb = KnuthBendix(congruence_kind.twosided, p, rewriting_system=rws)
+        check_partition_ids(knuth_bendix, kb, [0, 1], 5)
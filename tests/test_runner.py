@@ -8,11 +8,46 @@
 arising from runner.*pp in libsemigroups.
 """
 
+import _thread
+import asyncio
+import json
+import threading
+import time
 from datetime import datetime, timedelta
 
 import pytest
 
-from libsemigroups_pybind11 import Reporter
+from libsemigroups_pybind11 import (
+    UNDEFINED,
+    FroidurePin,
+    KnuthBendix,
+    LibsemigroupsError,
+    Order,
+    Presentation,
+    Reporter,
+    StopCondition,
+    ToddCoxeter,
+    Transf,
+    congruence_kind,
+    presentation,
+    runner,
+)
+
+
+def infinite_todd_coxeter():
+    """Returns a ToddCoxeter instance that never finishes."""
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    return ToddCoxeter(congruence_kind.twosided, p)
+
+
+def finite_todd_coxeter():
+    """Returns a ToddCoxeter instance that finishes quickly."""
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    return ToddCoxeter(congruence_kind.twosided, p)
 
 
 def test_reporter_000():
@@ -44,3 +79,228 @@ def test_reporter_000():
     assert s.report_every() == timedelta(seconds=1)
 
     assert s.report_every() == timedelta(seconds=1)
+
+
+def test_runner_000():
+    """Check that other Python threads run while a Runner is running."""
+    tc = infinite_todd_coxeter()
+    stop = threading.Event()
+    times = []
+
+    def work():
+        while not stop.is_set():
+            times.append(time.monotonic())
+
+    thread = threading.Thread(target=work)
+    thread.start()
+    start = time.monotonic()
+    tc.run_for(timedelta(milliseconds=500))
+    end = time.monotonic()
+    stop.set()
+    thread.join()
+
+    assert tc.timed_out()
+    assert any(start + 0.1 < t < end - 0.1 for t in times)
+
+
+def test_runner_001():
+    """Check that interrupting a Runner kills it."""
+    tc = infinite_todd_coxeter()
+    timer = threading.Timer(0.1, _thread.interrupt_main)
+    timer.start()
+    with pytest.raises(KeyboardInterrupt):
+        tc.run()
+    timer.join()
+    assert tc.dead()
+    assert not tc.finished()
+
+
+def test_runner_002():
+    """Check Runner.run_async and Runner.run_for_async."""
+    tc = finite_todd_coxeter()
+    future = tc.run_async()
+    assert future.result(timeout=60) is None
+    assert tc.finished()
+    assert tc.number_of_classes() == 5
+
+    tc = infinite_todd_coxeter()
+    future = tc.run_for_async(timedelta(milliseconds=50))
+    assert future.result(timeout=60) is None
+    assert tc.timed_out()
+    assert not tc.finished()
+
+    tc = infinite_todd_coxeter()
+    future = tc.run_async()
+    with pytest.raises(LibsemigroupsError):
+        tc.run_async()
+    assert future.cancel()
+    assert tc.dead()
+
+
+def test_runner_003():
+    """Check that Runner.run_async can be used with asyncio."""
+
+    async def run_all(runners):
+        await asyncio.gather(*(asyncio.wrap_future(x.run_async()) for x in runners))
+
+    runners = [finite_todd_coxeter() for _ in range(4)]
+    asyncio.run(run_all(runners))
+    assert all(x.finished() for x in runners)
+
+
+def test_runner_004():
+    """Check run_until with a StopCondition."""
+    S = FroidurePin(
+        Transf([1, 0, 2, 3, 4, 5]), Transf([1, 2, 3, 4, 5, 0]), Transf([0, 0, 2, 3, 4, 5])
+    )
+    cond = runner.current_size_at_least(S, 1000)
+    assert isinstance(cond, StopCondition)
+    assert not cond()
+    S.run_until(cond)
+    assert cond()
+    assert S.current_size() >= 1000
+    assert not S.finished()
+    assert S.stopped_by_predicate()
+
+    tc = infinite_todd_coxeter()
+    cond = runner.number_of_nodes_active_at_least(tc, 100)
+    tc.run_until(cond | runner.resident_set_size_at_least(2**50))
+    assert cond()
+    assert tc.stopped_by_predicate()
+
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    kb = KnuthBendix(congruence_kind.twosided, p)
+    kb.run_until(runner.number_of_active_rules_at_least(kb, 1))
+    assert kb.number_of_active_rules() >= 1
+
+
+def test_runner_005():
+    """Check combining StopCondition objects."""
+    tc = infinite_todd_coxeter()
+    yes = runner.resident_set_size_at_least(0)
+    no = runner.number_of_nodes_active_at_least(tc, 100)
+    assert yes()
+    assert not no()
+    assert not (yes & no)()
+    assert (yes | no)()
+    assert (~no)()
+    assert not (~yes)()
+    assert (yes & ~no)()
+
+
+def test_runner_006():
+    """Check memory_usage and run_with_memory_limit."""
+    tc = infinite_todd_coxeter()
+    assert tc.memory_usage() >= 0
+    assert tc.run_with_memory_limit(2**20)
+    assert not tc.finished()
+    assert tc.stopped_by_predicate()
+    assert tc.memory_usage() < 2**20
+
+    tc = finite_todd_coxeter()
+    assert not tc.run_with_memory_limit(2**30)
+    assert tc.finished()
+
+    S = FroidurePin(
+        Transf([1, 0, 2, 3, 4, 5]), Transf([1, 2, 3, 4, 5, 0]), Transf([0, 0, 2, 3, 4, 5])
+    )
+    assert S.memory_usage() > 0
+    assert S.run_with_memory_limit(2**16)
+    assert S.memory_usage() < 2**16
+    assert not S.finished()
+    assert not S.run_with_memory_limit(2**30)
+    assert S.finished()
+    assert S.size() == 46656
+
+
+def test_runner_007():
+    """Check runner.race."""
+    runners = [infinite_todd_coxeter(), finite_todd_coxeter()]
+    result = runner.race(runners, 2)
+    assert result.winner() == 1
+    assert runners[1].finished()
+    assert runners[1].number_of_classes() == 5
+    assert not runners[0].finished()
+    assert runners[0].dead()
+    assert len(result.run_times()) == 2
+    assert all(isinstance(t, timedelta) for t in result.run_times())
+
+    kb = KnuthBendix(congruence_kind.twosided, finite_todd_coxeter().presentation())
+    tc = infinite_todd_coxeter()
+    result = runner.race([kb, tc], 1)
+    assert result.winner() == 0
+    assert kb.number_of_classes() == 5
+    assert result.run_times()[1] == timedelta(0)
+    assert tc.dead()
+
+    assert runner.race([], 0).winner() == UNDEFINED
+
+
+def test_runner_008():
+    """Check MetricsStream and record_metrics."""
+    stream = runner.MetricsStream(3, timedelta(0))
+    assert stream.capacity() == 4
+    assert stream.interval() == timedelta(0)
+    assert stream.drain() == []
+    assert stream.dropped() == 0
+
+    tc = infinite_todd_coxeter()
+    tc.run_until(
+        runner.record_metrics(tc, stream) | runner.number_of_nodes_active_at_least(tc, 1000)
+    )
+    samples = stream.drain()
+    assert len(samples) == 4
+    assert stream.dropped() > 0
+    assert stream.drain() == []
+    assert all(x["name"] == "nodes" for x in samples)
+    assert samples == sorted(samples, key=lambda x: x["timestamp"])
+    assert samples[-1]["count"] >= samples[0]["count"]
+    assert len({x["thread_id"] for x in samples}) == 1
+
+    stream = runner.MetricsStream(1024, timedelta(seconds=10))
+    S = FroidurePin(Transf([1, 0, 2, 3, 4, 5]), Transf([1, 2, 3, 4, 5, 0]))
+    S.run_until(runner.record_metrics(S, stream))
+    assert S.finished()
+    assert [x["name"] for x in stream.drain()] == ["elements"]
+
+    with pytest.raises(LibsemigroupsError):
+        runner.MetricsStream(0)
+
+
+def test_runner_009(tmp_path):
+    """Check start_tracing, stop_tracing and write_trace."""
+    assert not runner.is_tracing()
+    tc = finite_todd_coxeter()
+    runner.start_tracing()
+    assert runner.is_tracing()
+    assert tc.number_of_classes() == 5
+    tc.standardize(Order.shortlex)
+    runner.race([infinite_todd_coxeter(), finite_todd_coxeter()], 2)
+    runner.stop_tracing()
+    assert not runner.is_tracing()
+    tc.standardize(Order.lex)
+
+    filename = tmp_path / "trace.json"
+    runner.write_trace(str(filename))
+    with open(filename, encoding="utf-8") as file:
+        events = json.load(file)["traceEvents"]
+    names = [e["name"] for e in events if e["ph"] == "B"]
+    assert names.count("ToddCoxeter.number_of_classes") == 1
+    assert names.count("ToddCoxeter.standardize") == 1
+    assert names.count("runner.race") == 1
+    assert names.count("Runner.run") == 2
+    assert sum(e["ph"] == "B" for e in events) == sum(e["ph"] == "E" for e in events)
+    assert len({e["tid"] for e in events if e["name"] == "Runner.run"}) == 2
+    assert all(e["ts"] >= 0 for e in events if e["ph"] != "M")
+
+    runner.start_tracing()
+    runner.stop_tracing()
+    runner.write_trace(str(filename))
+    with open(filename, encoding="utf-8") as file:
+        assert json.load(file)["traceEvents"] == []
+
+    with pytest.raises(LibsemigroupsError):
+        runner.write_trace(str(tmp_path / "does-not-exist" / "trace.json"))
@@ -10,7 +10,11 @@ arising from sims.*pp in libsemigroups.
 
 # pylint: disable=missing-function-docstring, invalid-name
 
+import concurrent.futures
+import json
+import multiprocessing
 import os
+from datetime import timedelta
 
 import pytest
 
@@ -24,8 +28,10 @@ from libsemigroups_pybind11 import (
     RepOrc,
     Sims1,
     Sims2,
+    SimsPredicate,
     SimsRefinerFaithful,
     SimsRefinerIdeals,
+    SimsThreadStats,
     ToddCoxeter,
     WordGraph,
     congruence_kind,
@@ -136,6 +142,11 @@ def test_sims1_000():
             [0, 0, 0, 0, 1, 0, 1, 1, 0],
         ],
     )
+    for threads in (1, 4):
+        indptr, indices = sims.poset_sparse(S.number_of_threads(threads), 5)
+        assert len(indptr) == 10
+        for i in range(9):
+            assert list(indices[indptr[i] : indptr[i + 1]]) == [j for j in range(9) if mat[i, j]]
     check_meets_and_joins(S.iterator(5))
 
 
@@ -583,3 +594,278 @@ def test_sims_refiner_ideals_uninit():
     s.presentation(p)
     with pytest.raises(ValueError):
         s.add_pruner(sri)
+
+
+def test_sims_parallel_iterator():
+    p = Presentation([0, 1, 2])
+    p.contains_empty_word(True)
+
+    presentation.add_rule(p, [0, 1, 0], [0, 0])
+    presentation.add_rule(p, [2, 2], [0, 0])
+    presentation.add_rule(p, [0, 0, 0], [0, 0])
+    presentation.add_rule(p, [2, 1], [1, 2])
+    presentation.add_rule(p, [2, 0], [0, 0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 2], [0, 0])
+
+    for Sims in (Sims1, Sims2):
+        S = Sims(p).number_of_threads(4)
+        expected = set(S.copy().number_of_threads(1).iterator(5))
+        it = S.parallel_iterator(5, capacity=3)
+        assert it.capacity() == 4
+        assert iter(it) is it
+        found = list(it)
+        assert len(found) == S.number_of_congruences(5)
+        assert set(found) == expected
+        with pytest.raises(StopIteration):
+            next(it)
+
+        it = S.parallel_iterator(5, capacity=1)
+        assert next(it) in expected
+        it.close()
+        with pytest.raises(StopIteration):
+            next(it)
+        del it
+
+        with pytest.raises(LibsemigroupsError):
+            S.parallel_iterator(0)
+        with pytest.raises(LibsemigroupsError):
+            S.parallel_iterator(5, capacity=0)
+        with pytest.raises(LibsemigroupsError):
+            Sims(word=list[int]).parallel_iterator(5)
+
+
+def test_sims_predicates():
+    p = Presentation([0, 1, 2])
+    p.contains_empty_word(True)
+
+    presentation.add_rule(p, [0, 1, 0], [0, 0])
+    presentation.add_rule(p, [2, 2], [0, 0])
+    presentation.add_rule(p, [0, 0, 0], [0, 0])
+    presentation.add_rule(p, [2, 1], [1, 2])
+    presentation.add_rule(p, [2, 0], [0, 0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 2], [0, 0])
+
+    preds = [
+        sims.max_nodes(3),
+        sims.compatible_with([[1, 2], [2]]),
+        sims.not_identified([0], [1]),
+        sims.faithful_on([[0], [1], [2]]),
+        sims.strictly_cyclic(),
+    ]
+    preds += [preds[0] & preds[2], preds[1] | preds[3], preds[0] & (preds[2] | preds[4])]
+    assert all(isinstance(pred, SimsPredicate) for pred in preds)
+    assert repr(preds[5]) == "<SimsPredicate (max_nodes(3) & not_identified([0], [1]))>"
+    assert repr(~preds[4]) == "<SimsPredicate ~strictly_cyclic()>"
+
+    for Sims in (Sims1, Sims2):
+        all_wgs = list(Sims(p).iterator(5))
+        for pred in preds:
+            expected = [wg for wg in all_wgs if pred(wg)]
+            S = Sims(p).number_of_threads(2).add_pruner(pred)
+            assert sorted(S.iterator(5)) == sorted(expected)
+            assert S.number_of_congruences(5) == len(expected)
+
+            wg = Sims(p).number_of_threads(2).find_if(5, pred)
+            assert wg in expected or (not expected and wg.number_of_nodes() == 0)
+            wg = Sims(p).find_if(5, ~pred)
+            assert wg.number_of_nodes() == 0 or not pred(wg)
+
+    wg = WordGraph(2, [[1, 1, 1], [1, 1, 1]])
+    assert not sims.not_identified([0], [1, 1])(wg)
+    assert sims.not_identified([], [1])(wg)
+    assert not sims.strictly_cyclic()(wg)
+    assert sims.strictly_cyclic()(WordGraph(2, [[1, 1, 1], [0, 1, 1]]))
+    assert sims.strictly_cyclic()(WordGraph(2, [[1, 1, 1], [1]]))
+    assert not sims.faithful_on([[0], [1]])(wg)
+    assert sims.max_nodes(2)(wg)
+    assert not sims.max_nodes(1)(wg)
+
+    with pytest.raises(LibsemigroupsError):
+        sims.compatible_with([[0]])
+    with pytest.raises(LibsemigroupsError):
+        sims.not_identified([3], [0])(wg)
+    with pytest.raises(LibsemigroupsError):
+        Sims1(p).add_pruner(sims.not_identified([3], [0]))
+    with pytest.raises(LibsemigroupsError):
+        Sims1(p).find_if(5, sims.faithful_on([[4], [0]]))
+
+    q = Presentation([0])
+    q.contains_empty_word(True)
+    presentation.add_rule(q, [0, 0], [0])
+    for Sims in (Sims1, Sims2):
+        S = Sims(p).add_pruner(sims.not_identified([0], [2])).presentation(q)
+        assert S.number_of_congruences(3) == 0
+
+
+def test_sims_split():
+    p = Presentation([0, 1, 2])
+    p.contains_empty_word(True)
+
+    presentation.add_rule(p, [0, 1, 0], [0, 0])
+    presentation.add_rule(p, [2, 2], [0, 0])
+    presentation.add_rule(p, [0, 0, 0], [0, 0])
+    presentation.add_rule(p, [2, 1], [1, 2])
+    presentation.add_rule(p, [2, 0], [0, 0])
+    presentation.add_rule(p, [1, 1], [1])
+    presentation.add_rule(p, [0, 2], [0, 0])
+
+    for Sims in (Sims1, Sims2):
+        S = Sims(p).long_rule_length(4)
+        long_rules = list(S.long_rules())
+        assert len(long_rules) != 0
+        units = sims.split(S, 5, 3)
+        assert len(units) == 8
+        for u in units:
+            assert u.first_long_rule_position == len(S.presentation().rules) - len(long_rules)
+            assert list(u.sims().long_rules()) == long_rules
+        assert all(sims.SimsWorkUnit.from_json(u.to_json()) == u for u in units)
+
+        ctx = multiprocessing.get_context("spawn")
+        with concurrent.futures.ProcessPoolExecutor(2, mp_context=ctx) as pool:
+            counts = list(pool.map(sims.run_work_unit, units))
+            graphs = list(pool.map(sims.run_work_unit, units, [True] * len(units)))
+        assert sims.merge(counts) == S.number_of_congruences(5)
+        assert sorted(sims.merge(graphs)) == sorted(S.iterator(5))
+
+        assert sims.merge([sims.run_work_unit(u) for u in sims.split(S, 5, 0)]) == (
+            S.number_of_congruences(5)
+        )
+
+    assert sims.merge([], word_graphs=False) == 0
+    assert sims.merge([], word_graphs=True) == []
+    with pytest.raises(ValueError):
+        sims.merge([])
+
+    S = Sims1(p).add_pruner(sims.max_nodes(3))
+    with pytest.raises(ValueError):
+        sims.split(S, 5, 2)
+    with pytest.raises(ValueError):
+        sims.split(Sims1(p), 5, -1)
+
+
+def test_sims_run_with_checkpoints(tmp_path):
+    p = Presentation([0, 1, 2, 3])
+    p.contains_empty_word(False)
+
+    presentation.add_identity_rules(p, 0)
+    presentation.add_rule(p, [1, 1], [0])
+    presentation.add_rule(p, [1, 3], [3])
+    presentation.add_rule(p, [2, 2], [2])
+    presentation.add_rule(p, [3, 1], [3])
+    presentation.add_rule(p, [3, 3], [3])
+    presentation.add_rule(p, [2, 3, 2], [2])
+    presentation.add_rule(p, [3, 2, 3], [3])
+    presentation.add_rule(p, [1, 2, 1, 2], [2, 1, 2])
+    presentation.add_rule(p, [2, 1, 2, 1], [2, 1, 2])
+
+    filename = str(tmp_path / "sims.json")
+    S = Sims1(p).number_of_threads(2)
+    assert sims.run_with_checkpoints(S, filename, 10, depth=3) == 86
+    assert sims.run_with_checkpoints(S, filename, 10, depth=3) == 86
+
+    # Simulate a search interrupted after 3 units
+    units = sims.split(S, 10, 3)
+    with open(filename, encoding="utf-8") as file:
+        state = json.load(file)
+    state["done"] = False
+    state["next"] = 3
+    state["count"] = sum(sims.run_work_unit(u) for u in units[:3])
+    with open(filename, "w", encoding="utf-8") as file:
+        json.dump(state, file)
+    assert sims.run_with_checkpoints(S, filename, 10, depth=3) == 86
+
+    with pytest.raises(ValueError):
+        sims.run_with_checkpoints(S, filename, 11, depth=3)
+    with pytest.raises(ValueError):
+        sims.run_with_checkpoints(S, str(tmp_path / "other.json"))
+
+    filename = str(tmp_path / "min-rep-orc.json")
+    orc = MinimalRepOrc(p).target_size(15).number_of_threads(2)
+    wg = sims.run_with_checkpoints(orc, filename, depth=2)
+    assert wg.number_of_nodes() == 7
+    assert sims.run_with_checkpoints(orc, filename, depth=2) == wg
+
+    orc = RepOrc(p).min_nodes(1).max_nodes(7).target_size(15)
+    wg = sims.run_with_checkpoints(orc, str(tmp_path / "rep-orc.json"), depth=2)
+    assert 0 < wg.number_of_nodes() <= 8
+    orc.max_nodes(3)
+    assert sims.run_with_checkpoints(orc, str(tmp_path / "none.json"), depth=2) == WordGraph()
+
+    with pytest.raises(TypeError):
+        sims.run_with_checkpoints(SimsRefinerFaithful([]), filename)
+
+
+def test_sims_write_word_graphs(tmp_path):
+    p = Presentation([0, 1, 2, 3])
+    p.contains_empty_word(False)
+
+    presentation.add_identity_rules(p, 0)
+    presentation.add_rule(p, [1, 1], [0])
+    presentation.add_rule(p, [1, 3], [3])
+    presentation.add_rule(p, [2, 2], [2])
+    presentation.add_rule(p, [3, 1], [3])
+    presentation.add_rule(p, [3, 3], [3])
+    presentation.add_rule(p, [2, 3, 2], [2])
+    presentation.add_rule(p, [3, 2, 3], [3])
+    presentation.add_rule(p, [1, 2, 1, 2], [2, 1, 2])
+    presentation.add_rule(p, [2, 1, 2, 1], [2, 1, 2])
+
+    S = Sims1(p).number_of_threads(4)
+    expected = sorted(bytes(memoryview(x)) for x in S.iterator(10))
+    for compressed in (False, True):
+        filename = str(tmp_path / f"sims-{compressed}.bin")
+        assert sims.write_word_graphs(S, 10, filename, compressed) == 86
+        r = sims.WordGraphReader(filename)
+        assert len(r) == 86
+        assert r.out_degree() == 4
+        assert all(1 < n <= 11 for n in r.number_of_nodes())
+        assert sorted(bytes(memoryview(x)) for x in r) == expected
+        assert r.array(0).shape == (r.number_of_nodes()[0], 4)
+        assert r[-1] == WordGraph(r.array(85))
+
+    filename = str(tmp_path / "empty.bin")
+    S.add_excluded_pair([0], [0])
+    assert sims.write_word_graphs(S, 10, filename) == 0
+    assert len(sims.WordGraphReader(filename)) == 0
+
+    with pytest.raises(LibsemigroupsError):
+        sims.write_word_graphs(S, 0, filename)
+    assert not os.path.exists(filename)
+    with pytest.raises(LibsemigroupsError):
+        sims.write_word_graphs(S, 10, str(tmp_path / "missing" / "file.bin"))
+    with open(filename, "wb") as file:
+        file.write(b"not a file of word graphs")
+    with pytest.raises(ValueError):
+        sims.WordGraphReader(filename)
+
+
+def test_sims_thread_stats():
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 1], [1, 0])
+
+    stats = SimsThreadStats(max_threads=2)
+    assert stats.number_of_threads() == 0
+    assert stats.max_threads() == 2
+    assert stats.idle_threshold() == timedelta(milliseconds=1)
+
+    S = Sims1(p).number_of_threads(4).add_pruner(stats.pruner())
+    assert S.number_of_congruences(4) == 117
+    assert 1 <= stats.number_of_threads() <= 2
+    for x in (stats.nodes(), stats.idle_time(), stats.idle_periods(), stats.max_depth()):
+        assert len(x) == stats.number_of_threads()
+    assert sum(stats.nodes()) >= 117
+    assert all(isinstance(t, timedelta) for t in stats.idle_time())
+    assert 1 <= max(stats.max_depth()) <= 5
+    assert all(d <= m for d, m in zip(stats.depth(), stats.max_depth(), strict=True))
+
+    stats.reset()
+    assert stats.number_of_threads() == 0
+    assert repr(stats) == "<SimsThreadStats with 0 threads and 0 nodes>"
+    S.number_of_threads(1)
+    assert S.number_of_congruences(4) == 117
+    assert stats.number_of_threads() == 1
+
+    with pytest.raises(LibsemigroupsError):
+        SimsThreadStats(0)
@@ -42,6 +42,7 @@ from libsemigroups_pybind11 import (
     Transf,
     WordGraph,
     congruence_kind,
+    froidure_pin,
     presentation,
     to,
 )
@@ -363,6 +364,33 @@ def test_to_FroidurePin_013():
     assert isinstance(fp, FroidurePin)
 
 
+def test_to_FroidurePin_word_graph_elements():
+    w = WordGraph(3, 2)
+    w.target(0, 0, 1)
+    w.target(1, 0, 2)
+    w.target(2, 0, 0)
+    w.target(0, 1, 1)
+    w.target(1, 1, 0)
+    w.target(2, 1, 2)
+
+    # The elements of fp have dynamic degree, and those constructed in Python
+    # of degree 3 do not, but they can be used interchangeably.
+    fp = to(w, rtype=(FroidurePin,))
+    assert fp.size() == 6
+    for i, x in enumerate(fp):
+        assert fp.position(x) == i
+        assert fp.current_position(x) == i
+        assert fp.contains(x)
+        assert x in list(fp)
+        assert fp.sorted_position(x) == fp.to_sorted_position(i)
+        assert froidure_pin.factorisation(fp, x) == froidure_pin.factorisation(fp, i)
+    assert fp.position(Transf([1, 2, 0])) == 0
+    assert not fp.contains(Transf([0, 0, 0]))
+    assert fp.position_many(list(fp)).tolist() == list(range(6))
+    assert fp.add_generator(fp[0]) is fp
+    assert fp.copy_closure([fp.generator(1)]).size() == 6
+
+
 ################################################################################
 # ToddCoxeter
 ################################################################################
@@ -31,7 +31,12 @@ from libsemigroups_pybind11 import (
 )
 from libsemigroups_pybind11.presentation import examples
 
-from .cong_common import check_congruence_common_return_policy
+from .cong_common import (
+    check_congruence_common_return_policy,
+    check_contains_many_and_reduce_many,
+    check_normal_forms_chunks,
+    check_partition_ids,
+)
 
 strategy = ToddCoxeter.options.strategy
 
@@ -492,3 +497,35 @@ def test_todd_coxeter_perform_lookbehind_until_no_checks():
         is tc
     )
     assert tc.number_of_nodes_active() < num_nodes
+
+
+def test_todd_coxeter_contains_many():
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    check_contains_many_and_reduce_many(ToddCoxeter(congruence_kind.twosided, p), "ab", 4)
+
+    p = Presentation([0, 1])
+    presentation.add_rule(p, [0, 0, 0], [0])
+    presentation.add_rule(p, [1, 1], [1])
+    check_contains_many_and_reduce_many(ToddCoxeter(congruence_kind.onesided, p), [0, 1], 4)
+
+
+def test_todd_coxeter_normal_forms_chunks():
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    check_normal_forms_chunks(todd_coxeter, ToddCoxeter(congruence_kind.twosided, p), 100)
+
+    tc = ToddCoxeter(congruence_kind.twosided, examples.full_transformation_monoid(4))
+    check_normal_forms_chunks(todd_coxeter, tc, 256)
+
+
+def test_todd_coxeter_partition_ids():
+    p = Presentation("ab")
+    presentation.add_rule(p, "aaa", "a")
+    presentation.add_rule(p, "bb", "b")
+    presentation.add_rule(p, "ab", "ba")
+    check_partition_ids(todd_coxeter, ToddCoxeter(congruence_kind.twosided, p), "ab", 5)
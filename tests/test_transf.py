@@ -309,3 +309,28 @@ def test_transf_mult_diff_degrees():
             assert x * y == x
         with pytest.raises(ValueError):
             assert y * x == y
+
+
+def test_static_degrees():
+    for T in (Transf, PPerm, Perm):
+        x = T([1, 0] + list(range(2, 16)))
+        assert x.degree() == 16
+        assert x.py_template_params == (2**8, 16)
+        assert x * x == T.one(16)
+        assert T.one(16) < x
+
+        # Across the boundary between static and dynamic degrees
+        x.increase_degree_by(1)
+        assert x.py_template_params == (2**8,)
+        assert x == T([1, 0] + list(range(2, 17)))
+        assert T.one(16) < x
+        x.increase_degree_by(15)
+        assert x.py_template_params == (2**8, 32)
+        assert x == T([1, 0] + list(range(2, 32)))
+
+        y = T([0, 1])
+        x.swap(y)
+        assert x == T([0, 1])
+        assert x.py_template_params == (2**8, 2)
+        assert y.degree() == 32
+        assert y.py_template_params == (2**8, 32)
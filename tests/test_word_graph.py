@@ -12,6 +12,7 @@ libsemigroups_pybind11.
 
 import copy
 
+import numpy as np
 import pytest
 
 from _libsemigroups_pybind11 import LIBSEMIGROUPS_EIGEN_ENABLED
@@ -28,9 +29,6 @@ from libsemigroups_pybind11 import (
     word_graph,
 )
 
-if LIBSEMIGROUPS_EIGEN_ENABLED:
-    import numpy as np
-
 
 @pytest.fixture(name="word_graphs")
 def word_graph_fixture():
@@ -367,3 +365,38 @@ def test_meeter_return_policy():
 def test_joiner_return_policy():
     join = Joiner()
     assert join.copy() is not join
+
+
+def test_word_graph_numpy():
+    wg = WordGraph(4, [[1, 2], [2], [3, 3], [0]])
+    a = np.asarray(wg)
+    assert a.shape == (4, 2)
+    assert a.dtype == np.uint32
+    assert a.tolist() == [[1, 2], [2, 2**32 - 1], [3, 3], [0, 2**32 - 1]]
+    assert not a.flags.writeable
+    with pytest.raises(ValueError):
+        a[0, 0] = 1
+    assert WordGraph(a.copy()) == wg
+    assert WordGraph(np.ascontiguousarray(a)) == wg
+
+    # Rows with unused capacity
+    wg = WordGraph(3, 2)
+    wg.reserve(3, 5)
+    wg.target(0, 1, 2)
+    wg.target(2, 0, 1)
+    assert np.asarray(wg).tolist() == [[2**32 - 1, 2], [2**32 - 1, 2**32 - 1], [1, 2**32 - 1]]
+
+    for wg in (WordGraph(), WordGraph(3, 0), WordGraph(0, 3)):
+        assert np.asarray(wg).shape == (wg.number_of_nodes(), wg.out_degree())
+        assert WordGraph(np.asarray(wg).copy()) == wg
+
+    targets = np.zeros((10, 3), dtype=np.uint32)
+    assert WordGraph(targets).number_of_edges() == 30
+    with pytest.raises(LibsemigroupsError):
+        WordGraph(np.zeros((3,), dtype=np.uint32))
+    with pytest.raises(LibsemigroupsError):
+        WordGraph(np.zeros((3, 2), dtype=np.uint32, order="F"))
+    with pytest.raises(LibsemigroupsError):
+        WordGraph(np.full((3, 2), 3, dtype=np.uint32))
+    with pytest.raises(TypeError):
+        WordGraph(np.zeros((3, 2), dtype=np.int64))